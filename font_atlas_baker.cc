@@ -0,0 +1,32 @@
+// font_atlas_baker - tool to bake the ImGui font atlas, GUI font and key
+// label glyphs in one single channel texture, into the file the program
+// links in as resources::fontAtlas
+
+#include <cstdio>
+#include <vector>
+#include "src/fontloader.hh"
+
+int main(int argc, char **argv)
+{
+	if (argc < 3) {
+		printf("Usage: %s <font.ttf> <atlas output>\n", argv[0]);
+		return 1;
+	}
+
+	FILE *f = fopen(argv[1], "rb");
+	if (!f) {
+		printf("Failed to open \"%s\"\n", argv[1]);
+		return 1;
+	}
+	std::vector<unsigned char> ttf;
+	unsigned char buffer[1 << 16];
+	size_t read;
+	while ((read = fread(buffer, 1, sizeof(buffer), f)) > 0)
+		ttf.insert(ttf.end(), buffer, buffer + read);
+	fclose(f);
+
+	// the key of the atlas hashes the font, so it has to be the same file
+	// as the one linked in
+	const resources::Span span = { ttf.data(), ttf.size() };
+	return FontLoader::bakeFonts(span, argv[2]) ? 0 : 1;
+}
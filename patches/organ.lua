@@ -0,0 +1,3 @@
+function wave(w, t)
+	return (math.sin(w*t) + 0.5*math.sin(2*w*t) + 0.25*math.sin(4*w*t))/1.75
+end
@@ -0,0 +1,7 @@
+function wave(w, t)
+	if math.sin(w*t) >= 0 then
+		return 0.5
+	else
+		return -0.5
+	end
+end
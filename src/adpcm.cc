@@ -0,0 +1,114 @@
+#include "adpcm.hh"
+
+#include <algorithm>
+
+namespace adpcm {
+
+static const int stepTable[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37,
+	41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173,
+	190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+	724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+	2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484,
+	7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500,
+	20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int indexTable[16] = {
+	-1, -1, -1, -1, 2, 4, 6, 8,
+	-1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static inline int clampSample(int value)
+{
+	return std::min(std::max(value, -32768), 32767);
+}
+
+static inline int clampIndex(int index)
+{
+	return std::min(std::max(index, 0), 88);
+}
+
+// same arithmetic on both ends, so that the encoder tracks exactly what
+// the decoder will reconstruct
+static inline void step(int nibble, int *predictor, int *index)
+{
+	const int size = stepTable[*index];
+	int delta = size >> 3;
+	if (nibble & 4)
+		delta += size;
+	if (nibble & 2)
+		delta += size >> 1;
+	if (nibble & 1)
+		delta += size >> 2;
+	*predictor = clampSample(*predictor + ((nibble & 8) ? -delta : delta));
+	*index = clampIndex(*index + indexTable[nibble]);
+}
+
+static int encodeSample(int sample, int *predictor, int *index)
+{
+	int size = stepTable[*index];
+	int difference = sample - *predictor;
+	int nibble = 0;
+	if (difference < 0) {
+		nibble = 8;
+		difference = -difference;
+	}
+	for (int bit = 4; bit; bit >>= 1) {
+		if (difference >= size) {
+			nibble |= bit;
+			difference -= size;
+		}
+		size >>= 1;
+	}
+	step(nibble, predictor, index);
+	return nibble;
+}
+
+size_t EncodedBytes(size_t samples)
+{
+	return (samples + blockSamples - 1)/blockSamples*blockBytes;
+}
+
+void Encode(const sf::Int16 *samples, size_t count, uint8_t *out)
+{
+	int index = 0;
+	for (size_t first = 0; first < count; first += blockSamples) {
+		const size_t available = std::min(blockSamples, count - first);
+		auto at = [&](size_t i) {
+			return i < available ? samples[first + i] : 0;
+		};
+		int predictor = at(0);
+		out[0] = predictor & 0xff;
+		out[1] = (predictor >> 8) & 0xff;
+		out[2] = index;
+		out[3] = 0;
+		uint8_t *nibbles = out + 4;
+		std::fill(nibbles, out + blockBytes, 0);
+		for (size_t i = 1; i < blockSamples; i++) {
+			const int nibble = encodeSample(at(i), &predictor, &index);
+			nibbles[(i - 1)/2] |= (i - 1) % 2 ? nibble << 4 : nibble;
+		}
+		out += blockBytes;
+	}
+}
+
+void DecodeBlock(const uint8_t *block, sf::Int16 *out)
+{
+	int predictor = (sf::Int16)(block[0] | block[1] << 8);
+	int index = clampIndex(block[2]);
+	out[0] = predictor;
+	const uint8_t *nibbles = block + 4;
+	for (size_t i = 1; i + 1 < blockSamples; i += 2) {
+		const int pair = *nibbles++;
+		step(pair & 0xf, &predictor, &index);
+		out[i] = predictor;
+		step(pair >> 4, &predictor, &index);
+		out[i + 1] = predictor;
+	}
+	step(*nibbles & 0xf, &predictor, &index);
+	out[blockSamples - 1] = predictor;
+}
+
+}
+
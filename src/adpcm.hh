@@ -0,0 +1,30 @@
+#ifndef ADPCM_HH
+#define ADPCM_HH
+
+#include <SFML/System.hpp>
+#include <cstddef>
+#include <cstdint>
+
+// IMA ADPCM in independent blocks, four bits a sample. Every block starts
+// with its first sample and step index in full, so any block can be
+// decoded without the ones before it, which is what lets a voice jump
+// back to the start of its bank when it loops.
+namespace adpcm {
+
+const size_t blockSamples = 1024;
+// first sample, step index and a spare byte, then a nibble per sample
+// after the first
+const size_t blockBytes = 4 + blockSamples/2;
+
+size_t EncodedBytes(size_t samples);
+
+// the last block is padded with silence
+void Encode(const sf::Int16 *samples, size_t count, uint8_t *out);
+
+// all blockSamples samples of the block
+void DecodeBlock(const uint8_t *block, sf::Int16 *out);
+
+}
+
+#endif
+
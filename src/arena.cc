@@ -0,0 +1,81 @@
+#include "arena.hh"
+#include "adpcm.hh"
+#include "constants.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+size_t SampleBank::Bytes() const
+{
+	return blocks ? adpcm::EncodedBytes(count) : count*sizeof(sf::Int16);
+}
+
+void SampleBank::Read(size_t from, size_t n, sf::Int16 *out) const
+{
+	n = from < count ? std::min(n, count - from) : 0;
+	if (first) {
+		memcpy(out, first + from, n*sizeof(sf::Int16));
+		return;
+	}
+	sf::Int16 decoded[adpcm::blockSamples];
+	while (n) {
+		const size_t block = from/adpcm::blockSamples,
+			offset = from % adpcm::blockSamples,
+			run = std::min(n, adpcm::blockSamples - offset);
+		adpcm::DecodeBlock(blocks + block*adpcm::blockBytes, decoded);
+		memcpy(out, decoded + offset, run*sizeof(sf::Int16));
+		out += run;
+		from += run;
+		n -= run;
+	}
+}
+
+// banks start on a cache line of their own
+SampleArena::SampleArena(size_t bankCount, size_t bankSamples,
+		bool compressed)
+{
+	const size_t alignment = Constants.arenaAlignment;
+	const size_t bankBytes = compressed ? adpcm::EncodedBytes(bankSamples) :
+		bankSamples*sizeof(sf::Int16);
+	stride = (bankBytes + alignment - 1)/alignment*alignment;
+	void *allocated = nullptr;
+	if (posix_memalign(&allocated, alignment,
+				std::max<size_t>(bankCount*stride, 1)) != 0)
+		throw std::bad_alloc();
+	memory = (uint8_t*)allocated;
+	for (size_t i = 0; i < bankCount; i++)
+		banks.push_back(compressed ?
+				SampleBank(nullptr, BankBlocks(i), bankSamples) :
+				SampleBank(BankMemory(i), nullptr, bankSamples));
+}
+
+SampleArena::~SampleArena()
+{
+	free(memory);
+}
+
+std::shared_ptr<SampleArena> SampleArena::Create(size_t bankCount,
+		size_t bankSamples, bool compressed)
+{
+	return std::shared_ptr<SampleArena>(new SampleArena(bankCount, bankSamples,
+				compressed));
+}
+
+sf::Int16* SampleArena::BankMemory(size_t bank)
+{
+	return (sf::Int16*)(memory + bank*stride);
+}
+
+uint8_t* SampleArena::BankBlocks(size_t bank)
+{
+	return memory + bank*stride;
+}
+
+std::shared_ptr<const SampleBank> SampleArena::Bank(
+		const std::shared_ptr<SampleArena> &arena, size_t bank)
+{
+	return std::shared_ptr<const SampleBank>(arena, &arena->banks[bank]);
+}
+
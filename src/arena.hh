@@ -0,0 +1,63 @@
+#ifndef ARENA_HH
+#define ARENA_HH
+
+#include <SFML/System.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// The samples of one note, somewhere inside the arena they were rendered
+// into. A compressed bank holds ADPCM blocks instead, see adpcm.hh, and
+// has no data() to read from directly.
+class SampleBank
+{
+	const sf::Int16 *first;
+	const uint8_t *blocks;
+	size_t count;
+public:
+	SampleBank(const sf::Int16 *nFirst, const uint8_t *nBlocks, size_t nCount)
+		: first(nFirst), blocks(nBlocks), count(nCount) {
+	}
+
+	const sf::Int16* data() const {
+		return first;
+	}
+	size_t size() const {
+		return count;
+	}
+	const uint8_t* Blocks() const {
+		return blocks;
+	}
+	size_t Bytes() const;
+	// decodes as needed
+	void Read(size_t from, size_t n, sf::Int16 *out) const;
+};
+
+// Banks in a single aligned allocation. Notes are rendered straight into
+// it and voices play from it in place. The banks handed out share
+// ownership of the whole arena, which is freed at once when the last of
+// them goes away; the compiler gives every bank one of its own, so that
+// the cache can free them one at a time.
+class SampleArena
+{
+	uint8_t *memory;
+	size_t stride;
+	std::vector<SampleBank> banks;
+
+	SampleArena(size_t bankCount, size_t bankSamples, bool compressed);
+public:
+	SampleArena(const SampleArena&) = delete;
+	SampleArena& operator=(const SampleArena&) = delete;
+	~SampleArena();
+
+	static std::shared_ptr<SampleArena> Create(size_t bankCount,
+			size_t bankSamples, bool compressed);
+	sf::Int16* BankMemory(size_t bank);
+	uint8_t* BankBlocks(size_t bank);
+	static std::shared_ptr<const SampleBank> Bank(
+			const std::shared_ptr<SampleArena> &arena, size_t bank);
+};
+
+#endif
+
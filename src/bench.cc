@@ -0,0 +1,497 @@
+#include "bench.hh"
+#include "adpcm.hh"
+#include "constants.hh"
+#include "profiler.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <time.h>
+
+static double threadMicroseconds()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+	return now.tv_sec*1e6 + now.tv_nsec/1e3;
+}
+
+// sleeping counts here, unlike in threadMicroseconds()
+static double wallMicroseconds()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec*1e6 + now.tv_nsec/1e3;
+}
+
+Benchmark::Benchmark(Gui *nGui, Keyboard *nKeyboard, Take *nTake,
+		Input *nInput, const sf::Clock *nClock)
+{
+	gui = nGui;
+	keyboard = nKeyboard;
+	take = nTake;
+	input = nInput;
+	clock = nClock;
+	slowMilliseconds = 0;
+}
+
+bool Benchmark::LoadScript(const char *filename)
+{
+	if (!filename)
+		return parseScript(Constants.defaultBenchScript, "built-in");
+	FILE *f = fopen(filename, "rb");
+	if (!f) {
+		printf("Failed to open benchmark script \"%s\"\n", filename);
+		return false;
+	}
+	fseek(f, 0, SEEK_END);
+	size_t fileSize = ftell(f);
+	rewind(f);
+	std::string script(fileSize, '\0');
+	if (fread(&script[0], 1, fileSize, f) != fileSize) {
+		printf("Failed to read benchmark script \"%s\"\n", filename);
+		fclose(f);
+		return false;
+	}
+	fclose(f);
+	return parseScript(script, filename);
+}
+
+bool Benchmark::parseScript(const std::string &script, const char *name)
+{
+	std::istringstream lines(script);
+	std::string line;
+	int lineNumber = 0;
+	steps.clear();
+	while (std::getline(lines, line)) {
+		lineNumber++;
+		std::istringstream tokens(line);
+		std::string command, argument;
+		if (!(tokens >> command) || command[0] == '#')
+			continue;
+
+		Step step = { Step::Step_Frames, 0, 0, nullptr, "" };
+		bool valid = true;
+		if (command == "frames") {
+			step.kind = Step::Step_Frames;
+			valid = (tokens >> step.x >> step.text) && step.x > 0;
+		} else if (command == "tab") {
+			step.kind = Step::Step_Tab;
+			valid = (bool)(tokens >> argument);
+			if (argument == "wave")
+				step.x = GlobalsHolder::Tab_Wave;
+			else if (argument == "roll")
+				step.x = GlobalsHolder::Tab_PianoRoll;
+			else if (argument == "settings")
+				step.x = GlobalsHolder::Tab_Settings;
+			else if (argument == "performance")
+				step.x = GlobalsHolder::Tab_Performance;
+			else
+				valid = false;
+		} else if (command == "expand") {
+			step.kind = Step::Step_Expand;
+			valid = (tokens >> argument) && (argument == "on" || argument == "off");
+			step.x = argument == "on";
+		} else if (command == "mouse") {
+			step.kind = Step::Step_Mouse;
+			valid = (bool)(tokens >> step.x >> step.y);
+		} else if (command == "down" || command == "up") {
+			step.kind = Step::Step_Button;
+			step.x = command == "down";
+		} else if (command == "wheel") {
+			step.kind = Step::Step_Wheel;
+			valid = (bool)(tokens >> step.x);
+		} else if (command == "type") {
+			step.kind = Step::Step_Type;
+			tokens >> std::ws;
+			std::getline(tokens, step.text);
+		} else if (command == "press" || command == "release") {
+			step.kind = Step::Step_Press;
+			step.x = command == "press";
+			valid = (tokens >> argument) &&
+				(step.key = keyboard->LookupName(argument.c_str()));
+		} else if (command == "slow") {
+			step.kind = Step::Step_Slow;
+			valid = (tokens >> step.x) && step.x >= 0;
+		} else {
+			valid = false;
+		}
+		if (!valid) {
+			printf("Benchmark script \"%s\", line %d: can't make sense of \"%s\"\n",
+					name, lineNumber, line.c_str());
+			return false;
+		}
+		steps.push_back(step);
+	}
+	return true;
+}
+
+// the take is written here at simulated time rather than by Input, so
+// that two runs draw the same piano roll
+void Benchmark::apply(const Step &step, double now)
+{
+	ImGuiIO &io = ImGui::GetIO();
+	switch (step.kind) {
+		case Step::Step_Tab:
+			gui->SelectTab((GlobalsHolder::Tab)step.x);
+			break;
+		case Step::Step_Expand:
+			gui->expandHeaders = step.x;
+			break;
+		case Step::Step_Mouse:
+			gui->mousePosX = step.x;
+			gui->mousePosY = step.y;
+			break;
+		case Step::Step_Button:
+			gui->mousePressed[0] = step.x;
+			break;
+		case Step::Step_Wheel:
+			io.MouseWheel += step.x;
+			break;
+		case Step::Step_Type:
+			for (char c : step.text)
+				io.AddInputCharacter(c);
+			break;
+		case Step::Step_Press:
+			// sent as the next frame starts, see send()
+			pending.push_back(&step);
+			if (step.x)
+				take->NoteOn(step.key->note.Pitch(), now);
+			else
+				take->NoteOff(step.key->note.Pitch(), now);
+			break;
+		case Step::Step_Slow:
+			slowMilliseconds = step.x;
+			break;
+		case Step::Step_Frames:
+			break;
+	}
+}
+
+// hands the pending key steps to the input thread, stamped now as a
+// window would have them
+void Benchmark::send()
+{
+	if (pending.empty())
+		return;
+	std::lock_guard<std::mutex> lock(queueMutex);
+	for (const Step *step : pending) {
+		Input::Event event;
+		event.event.type = step->x ? sf::Event::KeyPressed :
+			sf::Event::KeyReleased;
+		event.event.key.code = step->key->key;
+		event.event.key.alt = false;
+		event.event.key.control = false;
+		event.event.key.shift = false;
+		event.event.key.system = false;
+		event.stamp = clock->getElapsedTime();
+		queued.push_back(event);
+		sentSlow.push_back(slowMilliseconds);
+	}
+	pending.clear();
+}
+
+bool Benchmark::receive(Input::Event *event)
+{
+	std::lock_guard<std::mutex> lock(queueMutex);
+	if (queued.empty())
+		return false;
+	*event = queued.front();
+	queued.erase(queued.begin());
+	return true;
+}
+
+// The clock is simulated, every frame advances it by the same amount, so
+// that two runs of the same script draw the same frames. Key presses
+// arrive as a frame starts building, right after the poll at the top of
+// the main loop, where polling on the main thread used to keep them
+// waiting longest. Building is slowed down where the main loop would be
+// slow.
+void Benchmark::Run(sf::RenderTexture *target,
+		const std::function<void()> &buildFrame)
+{
+	const int frameMilliseconds = Constants.bench.frameMilliseconds;
+	double now = 0;
+	frames.clear();
+	pending.clear();
+	queued.clear();
+	sentSlow.clear();
+	latencies.clear();
+	slowMilliseconds = 0;
+	input->Start([this](Input::Event *event) {
+		return receive(event);
+	}, true);
+	for (size_t s = 0; s < steps.size(); s++) {
+		if (steps[s].kind != Step::Step_Frames) {
+			apply(steps[s], now);
+			continue;
+		}
+		for (int i = 0; i < steps[s].x; i++) {
+			gui->Update(frameMilliseconds);
+			input->Poll();
+
+			Frame frame;
+			frame.step = s;
+			const double start = threadMicroseconds();
+			send();
+			buildFrame();
+			if (slowMilliseconds)
+				sf::sleep(sf::milliseconds(slowMilliseconds));
+			const double built = threadMicroseconds();
+			input->Poll();
+			target->clear(Constants.backgroundColor);
+			const double cleared = threadMicroseconds();
+			gui->Draw();
+			const double rendered = threadMicroseconds();
+			keyboard->Draw(target);
+			const double drawn = threadMicroseconds();
+			input->Poll();
+			target->display();
+			const double end = threadMicroseconds();
+
+			frame.build = built - start;
+			frame.render = rendered - cleared;
+			frame.keyboard = drawn - rendered;
+			frame.total = end - start;
+			frames.push_back(frame);
+			now += frameMilliseconds/1000.;
+			for (double latency : input->TakeLatencies())
+				latencies.push_back(latency);
+			// outside of the timings, only does anything when tracing
+			profiler::Collect();
+		}
+	}
+
+	// events sent with the last frames may still be on their way
+	const sf::Time deadline = clock->getElapsedTime() +
+		sf::milliseconds(Constants.bench.drainMilliseconds);
+	send();
+	while (latencies.size() < sentSlow.size() &&
+			clock->getElapsedTime() < deadline) {
+		sf::sleep(sf::milliseconds(1));
+		for (double latency : input->TakeLatencies())
+			latencies.push_back(latency);
+	}
+	input->Stop();
+	input->Poll();
+}
+
+static void writeSummary(FILE *f, const char *name, std::vector<double> values)
+{
+	std::sort(values.begin(), values.end());
+	double sum = 0;
+	for (double value : values)
+		sum += value;
+	fprintf(f, ",\n\t\t  \"%s\": { \"mean\": %.1f, \"median\": %.1f, "
+			"\"p95\": %.1f, \"max\": %.1f }",
+			name, sum/values.size(), values[values.size()/2],
+			values[std::min(values.size() - 1, values.size()*95/100)],
+			values.back());
+}
+
+// mean, median, 95th percentile and maximum of every phase over the frames
+// of one step, or of all of them for a negative step
+void Benchmark::writeStats(FILE *f, int step) const
+{
+	static const struct {
+		const char *name;
+		double Frame::*field;
+	} phases[] = {
+		{ "build_us", &Frame::build },
+		{ "render_us", &Frame::render },
+		{ "keyboard_us", &Frame::keyboard },
+		{ "total_us", &Frame::total },
+	};
+	std::vector<double> values;
+	int count = 0;
+	for (auto &frame : frames)
+		count += step < 0 || frame.step == step;
+	fprintf(f, "\t\t{ \"step\": \"%s\", \"frames\": %d",
+			step < 0 ? "all" : steps[step].text.c_str(), count);
+	if (count == 0) {
+		fprintf(f, " }");
+		return;
+	}
+	for (auto &phase : phases) {
+		values.clear();
+		for (auto &frame : frames)
+			if (step < 0 || frame.step == step)
+				values.push_back(frame.*phase.field);
+		writeSummary(f, phase.name, values);
+	}
+	fprintf(f, " }");
+}
+
+// slow settings in the order they were first sent under
+static std::vector<int> slowSettings(const std::vector<int> &sentSlow)
+{
+	std::vector<int> settings;
+	for (int slow : sentSlow)
+		if (std::find(settings.begin(), settings.end(), slow) == settings.end())
+			settings.push_back(slow);
+	return settings;
+}
+
+static std::vector<double> latenciesUnder(int slow,
+		const std::vector<int> &sentSlow, const std::vector<double> &latencies)
+{
+	std::vector<double> values;
+	for (size_t i = 0; i < latencies.size() && i < sentSlow.size(); i++)
+		if (sentSlow[i] == slow)
+			values.push_back(latencies[i]);
+	return values;
+}
+
+static double median(std::vector<double> values)
+{
+	std::sort(values.begin(), values.end());
+	return values[values.size()/2];
+}
+
+// key latency of the events sent under every slow setting; any that never
+// reached the engine are counted as lost
+void Benchmark::writeLatency(FILE *f) const
+{
+	const std::vector<int> settings = slowSettings(sentSlow);
+	for (size_t s = 0; s < settings.size(); s++) {
+		const int sent = std::count(sentSlow.begin(), sentSlow.end(), settings[s]);
+		const std::vector<double> values =
+			latenciesUnder(settings[s], sentSlow, latencies);
+		fprintf(f, "\t\t{ \"slow_ms\": %d, \"events\": %d, \"lost\": %d",
+				settings[s], sent, sent - (int)values.size());
+		if (!values.empty())
+			writeSummary(f, "key_latency_us", values);
+		fprintf(f, " }%s\n", s + 1 < settings.size() ? "," : "");
+	}
+}
+
+bool Benchmark::WriteJson(const char *filename) const
+{
+	FILE *f = fopen(filename, "wb");
+	if (!f) {
+		printf("Failed to open \"%s\" for writing\n", filename);
+		return false;
+	}
+	fprintf(f, "{\n\t\"frame_ms\": %d,\n\t\"summary\": [\n",
+			Constants.bench.frameMilliseconds);
+	writeStats(f, -1);
+	for (size_t s = 0; s < steps.size(); s++)
+		if (steps[s].kind == Step::Step_Frames) {
+			fprintf(f, ",\n");
+			writeStats(f, s);
+		}
+	fprintf(f, "\n\t],\n\t\"key_latency\": [\n");
+	writeLatency(f);
+	fprintf(f, "\t],\n\t\"frames\": [\n");
+	for (size_t i = 0; i < frames.size(); i++) {
+		fprintf(f, "\t\t{ \"step\": \"%s\", \"build_us\": %.1f, "
+				"\"render_us\": %.1f, \"keyboard_us\": %.1f, \"total_us\": %.1f",
+				steps[frames[i].step].text.c_str(), frames[i].build,
+				frames[i].render, frames[i].keyboard, frames[i].total);
+		fprintf(f, " }%s\n", i + 1 < frames.size() ? "," : "");
+	}
+	fprintf(f, "\t]\n}\n");
+	const bool written = !ferror(f);
+	fclose(f);
+	if (!written)
+		printf("Failed to write \"%s\"\n", filename);
+	return written;
+}
+
+// a key has to reach the engine as soon under slow frames as at normal
+// speed, give or take Constants.bench.keyLatencyToleranceMicroseconds
+bool Benchmark::CheckLatency() const
+{
+	if (latencies.size() < sentSlow.size()) {
+		printf("Benchmark: %zu of %zu key events never reached the engine\n",
+				sentSlow.size() - latencies.size(), sentSlow.size());
+		return false;
+	}
+	const std::vector<double> normal = latenciesUnder(0, sentSlow, latencies);
+	if (normal.empty())
+		return true;
+	const double limit = median(normal) +
+		Constants.bench.keyLatencyToleranceMicroseconds;
+	bool passed = true;
+	for (int slow : slowSettings(sentSlow)) {
+		if (slow == 0)
+			continue;
+		const double slowMedian =
+			median(latenciesUnder(slow, sentSlow, latencies));
+		if (slowMedian > limit) {
+			printf("Benchmark: keys take %.0f us to reach the engine with "
+					"frames %d ms slower, %.0f us at normal speed\n",
+					slowMedian, slow, median(normal));
+			passed = false;
+		}
+	}
+	return passed;
+}
+
+void RunCodecBenchmark(const std::vector<Samples> &banks)
+{
+	const size_t blockSize = Constants.audio.blockSize;
+	size_t samples = 0, rawBytes = 0, encodedBytes = 0;
+	double signal = 0, noise = 0;
+	std::vector<std::vector<uint8_t>> encoded;
+	std::vector<sf::Int16> decoded(adpcm::blockSamples);
+	for (auto &bank : banks) {
+		encoded.emplace_back(adpcm::EncodedBytes(bank->size()));
+		adpcm::Encode(bank->data(), bank->size(), encoded.back().data());
+		for (size_t i = 0; i < bank->size(); i++) {
+			if (i % adpcm::blockSamples == 0)
+				adpcm::DecodeBlock(encoded.back().data() +
+						i/adpcm::blockSamples*adpcm::blockBytes, decoded.data());
+			const double error = decoded[i % adpcm::blockSamples] - bank->data()[i];
+			signal += (double)bank->data()[i]*bank->data()[i];
+			noise += error*error;
+		}
+		samples += bank->size();
+		rawBytes += bank->Bytes();
+		encodedBytes += encoded.back().size();
+	}
+	if (samples == 0) {
+		puts("Codec benchmark: no samples");
+		return;
+	}
+
+	// each pass plays every bank through once, as one voice would
+	std::vector<float> mix(blockSize);
+	double rawTime = 0, decodedTime = 0;
+	for (int pass = 0; pass < Constants.bench.codecPasses; pass++) {
+		double start = threadMicroseconds();
+		for (auto &bank : banks)
+			for (size_t i = 0; i < bank->size(); i++)
+				mix[i % blockSize] += bank->data()[i];
+		rawTime += threadMicroseconds() - start;
+
+		start = threadMicroseconds();
+		for (auto &bytes : encoded)
+			for (size_t b = 0; b < bytes.size()/adpcm::blockBytes; b++) {
+				adpcm::DecodeBlock(bytes.data() + b*adpcm::blockBytes,
+						decoded.data());
+				for (size_t i = 0; i < adpcm::blockSamples; i++)
+					mix[i % blockSize] += decoded[i];
+			}
+		decodedTime += threadMicroseconds() - start;
+	}
+	const double played = (double)samples*Constants.bench.codecPasses;
+	const double perBlock = 1e6*blockSize/Constants.samplesPerSecond;
+	const double rawVoice = rawTime/played*blockSize,
+		decodedVoice = decodedTime/played*blockSize;
+
+	printf("Codec benchmark, %zu banks, %zu samples (checksum %g):\n",
+			banks.size(), samples, (double)mix[0]);
+	printf("  raw      %8.1f KB\n", rawBytes/1024.);
+	printf("  adpcm    %8.1f KB  %.1f%% of raw, %.1f dB SNR\n",
+			encodedBytes/1024., 100.*encodedBytes/rawBytes,
+			10*log10(signal/std::max(noise, 1.)));
+	printf("  per voice and %zu sample block (%.0f us of audio):\n",
+			blockSize, perBlock);
+	printf("    mixing raw          %7.2f us  %.3f%%\n",
+			rawVoice, 100*rawVoice/perBlock);
+	printf("    decoding and mixing %7.2f us  %.3f%%\n",
+			decodedVoice, 100*decodedVoice/perBlock);
+	printf("  %.1f KB saved for %.2f us a voice\n",
+			(rawBytes - encodedBytes)/1024., decodedVoice - rawVoice);
+}
+
@@ -0,0 +1,90 @@
+#ifndef BENCH_HH
+#define BENCH_HH
+
+#include "engine.hh"
+#include "gui.hh"
+#include "input.hh"
+#include "keyboard.hh"
+#include "take.hh"
+
+#include <SFML/Graphics.hpp>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// --headless-bench: replays a script of GUI interactions and key presses
+// against an offscreen target and writes how much CPU time every frame
+// spent building the ImGui frame, in ImGuiRenderDrawLists and drawing the
+// keyboard. Key presses go through Input as in the main loop, on its
+// thread, and how long each took from arriving to reaching the engine is
+// written too, in wall clock time and grouped by how much frames were
+// slowed down on purpose; CheckLatency() fails the run when slow frames
+// hold keys back.
+// See Constants.defaultBenchScript for the script format.
+class Benchmark
+{
+	struct Step {
+		enum Kind {
+			Step_Tab,
+			Step_Expand,
+			Step_Mouse,
+			Step_Button,
+			Step_Wheel,
+			Step_Type,
+			Step_Press,
+			Step_Slow,
+			Step_Frames,
+		} kind;
+		int x, y;
+		Key *key;
+		std::string text;
+	};
+	struct Frame {
+		int step;
+		double build, render, keyboard, total;
+	};
+
+	Gui *gui;
+	Keyboard *keyboard;
+	Take *take;
+	Input *input;
+	const sf::Clock *clock;
+	std::vector<Step> steps;
+	std::vector<Frame> frames;
+	// key steps waiting for the next frame to start
+	std::vector<const Step*> pending;
+	int slowMilliseconds;
+
+	// what the input thread reads instead of a window
+	std::mutex queueMutex;
+	std::vector<Input::Event> queued;
+	// the slow setting every key event was sent under, and how long
+	// the ones that reached the engine took, in the same order
+	std::vector<int> sentSlow;
+	std::vector<double> latencies;
+
+	bool parseScript(const std::string &script, const char *name);
+	void apply(const Step &step, double now);
+	void send();
+	bool receive(Input::Event *event);
+	void writeStats(FILE *f, int step) const;
+	void writeLatency(FILE *f) const;
+public:
+	Benchmark(Gui *nGui, Keyboard *nKeyboard, Take *nTake, Input *nInput,
+			const sf::Clock *nClock);
+
+	bool LoadScript(const char *filename);
+	void Run(sf::RenderTexture *target, const std::function<void()> &buildFrame);
+	bool WriteJson(const char *filename) const;
+	bool CheckLatency() const;
+};
+
+// --codec-bench: compresses the banks of the wave script and prints what
+// that saves against what decoding them costs a voice, decoded and mixed
+// a block at a time the way the engine does. banks have to be raw.
+void RunCodecBenchmark(const std::vector<Samples> &banks);
+
+#endif
+
@@ -0,0 +1,142 @@
+#include "cache.hh"
+
+SampleCache::SampleCache()
+{
+	plays = 0;
+	residentBytes = 0;
+}
+
+SampleCache::Slot* SampleCache::slot(int patch, int voice)
+{
+	if (patch < 0 || patch >= (int)slots.size() ||
+			voice < 0 || voice >= (int)slots[patch].size())
+		return nullptr;
+	return &slots[patch][voice];
+}
+
+void SampleCache::Invalidate(int patch, size_t voices)
+{
+	if (patch < 0)
+		return;
+	if (patch >= (int)slots.size())
+		slots.resize(patch + 1);
+	for (auto &slot : slots[patch])
+		if (slot.samples)
+			residentBytes -= slot.samples->Bytes();
+	slots[patch].assign(voices, Slot());
+}
+
+void SampleCache::Truncate(size_t count)
+{
+	for (size_t patch = count; patch < slots.size(); patch++)
+		for (auto &slot : slots[patch])
+			if (slot.samples)
+				residentBytes -= slot.samples->Bytes();
+	if (count < slots.size())
+		slots.resize(count);
+}
+
+void SampleCache::Played(int patch, int voice)
+{
+	Slot *played = slot(patch, voice);
+	if (!played)
+		return;
+	played->lastPlayed = ++plays;
+	if (!played->samples)
+		played->wanted = true;
+}
+
+std::vector<int> SampleCache::TakeMissing(int patch)
+{
+	std::vector<int> missing;
+	if (patch < 0 || patch >= (int)slots.size())
+		return missing;
+	for (size_t i = 0; i < slots[patch].size(); i++) {
+		Slot &slot = slots[patch][i];
+		if (slot.wanted && !slot.requested) {
+			slot.requested = true;
+			missing.push_back(i);
+		}
+	}
+	return missing;
+}
+
+void SampleCache::Insert(int patch, int voice, const Samples &samples)
+{
+	Slot *inserted = slot(patch, voice);
+	if (!inserted)
+		return;
+	if (inserted->samples)
+		residentBytes -= inserted->samples->Bytes();
+	inserted->samples = samples;
+	if (inserted->samples)
+		residentBytes += inserted->samples->Bytes();
+	inserted->wanted = false;
+	inserted->requested = false;
+}
+
+void SampleCache::Retry(int patch)
+{
+	if (patch < 0 || patch >= (int)slots.size())
+		return;
+	for (auto &slot : slots[patch])
+		if (slot.requested && !slot.samples) {
+			slot.wanted = false;
+			slot.requested = false;
+		}
+}
+
+std::vector<int> SampleCache::Evict(size_t maxBytes, int active,
+		const std::vector<bool> &held)
+{
+	std::vector<int> evicted;
+	while (residentBytes > maxBytes) {
+		Slot *oldest = nullptr;
+		int oldestPatch = -1, oldestVoice = -1;
+		for (size_t p = 0; p < slots.size(); p++)
+			for (size_t i = 0; i < slots[p].size(); i++) {
+				Slot &slot = slots[p][i];
+				if (!slot.samples ||
+						((int)p == active && i < held.size() && held[i]))
+					continue;
+				if (!oldest || slot.lastPlayed < oldest->lastPlayed) {
+					oldest = &slot;
+					oldestPatch = p;
+					oldestVoice = i;
+				}
+			}
+		if (!oldest)
+			break;
+		residentBytes -= oldest->samples->Bytes();
+		oldest->samples.reset();
+		if (oldestPatch == active)
+			evicted.push_back(oldestVoice);
+	}
+	return evicted;
+}
+
+std::vector<int> SampleCache::Resident(int patch) const
+{
+	std::vector<int> resident;
+	if (patch < 0 || patch >= (int)slots.size())
+		return resident;
+	for (size_t i = 0; i < slots[patch].size(); i++)
+		if (slots[patch][i].samples)
+			resident.push_back(i);
+	return resident;
+}
+
+std::vector<Samples> SampleCache::Banks(int patch) const
+{
+	std::vector<Samples> banks;
+	if (patch < 0 || patch >= (int)slots.size())
+		return banks;
+	for (auto &slot : slots[patch])
+		banks.push_back(slot.samples);
+	return banks;
+}
+
+size_t SampleCache::ResidentBytes() const
+{
+	return residentBytes;
+}
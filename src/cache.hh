@@ -0,0 +1,60 @@
+#ifndef CACHE_HH
+#define CACHE_HH
+
+#include "note.hh"
+
+#include <cstdint>
+#include <vector>
+
+// Which voices of which patch have their samples in memory; patch 0 is
+// wave.lua, the rest are those of the PatchLibrary. A voice of the active
+// patch that is played without them is asked for, rendered, or read back
+// from the disk cache of the compiler, and stays resident until the banks
+// of every patch together take more than the cap; then the ones played
+// longest ago are dropped first, preloaded banks never played before any
+// other. Every bank is an arena of its own, see Compiler, so what the
+// cap counts is what an eviction gives back, once no voice plays it.
+// Only ever touched from the main thread.
+class SampleCache
+{
+	struct Slot {
+		Samples samples;
+		uint64_t lastPlayed;
+		bool wanted, requested;
+	};
+
+	// [patch][voice]
+	std::vector<std::vector<Slot>> slots;
+	uint64_t plays;
+	size_t residentBytes;
+
+	Slot* slot(int patch, int voice);
+public:
+	SampleCache();
+
+	// every bank of patch is stale, after a compile or a rescan
+	void Invalidate(int patch, size_t voices);
+	// forgets the patches from count on
+	void Truncate(size_t count);
+	void Played(int patch, int voice);
+	// played, but neither resident nor asked for yet; they count as asked
+	// for from now on
+	std::vector<int> TakeMissing(int patch);
+	void Insert(int patch, int voice, const Samples &samples);
+	// a render for patch failed: whatever was asked for and hasn't come
+	// is asked for again once played again
+	void Retry(int patch);
+	// played longest ago first, over every patch, until the rest fit into
+	// maxBytes; held voices of the active patch are never dropped. Returns
+	// the voices of the active patch that were.
+	std::vector<int> Evict(size_t maxBytes, int active,
+			const std::vector<bool> &held);
+
+	std::vector<int> Resident(int patch) const;
+	// one per voice, empty where not resident
+	std::vector<Samples> Banks(int patch) const;
+	// of every patch
+	size_t ResidentBytes() const;
+};
+
+#endif
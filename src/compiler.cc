@@ -0,0 +1,482 @@
+#include "compiler.hh"
+#include "adpcm.hh"
+#include "constants.hh"
+#include "profiler.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <sys/stat.h>
+
+// Bank cache files are named after the script they were rendered with, so
+// that everything left over from other scripts can be told apart and
+// removed, and carry a header with the full key of the bank in case the
+// name isn't enough.
+static const char bankMagic[4] = { 'S', 'Y', 'B', 'K' };
+static const uint32_t bankVersion = 1;
+
+struct BankHeader {
+	char magic[4];
+	uint32_t version;
+	uint64_t key;
+	uint64_t sampleCount, bytes;
+};
+
+static void hash(uint64_t *key, const void *data, size_t size)
+{
+	const unsigned char *bytes = (const unsigned char*)data;
+	for (size_t i = 0; i < size; i++) {
+		*key ^= bytes[i];
+		*key *= 1099511628211ull;
+	}
+}
+
+static std::string bankCacheDirectory()
+{
+	std::string directory;
+	if (const char *xdg = getenv("XDG_CACHE_HOME"))
+		directory = xdg;
+	else if (const char *home = getenv("HOME"))
+		directory = std::string(home) + "/.cache";
+	else
+		directory = ".";
+	mkdir(directory.c_str(), 0755);
+	directory += std::string("/") + Constants.bankCacheDirectory;
+	mkdir(directory.c_str(), 0755);
+	return directory;
+}
+
+static std::string scriptPrefix(uint64_t scriptKey)
+{
+	char prefix[32];
+	snprintf(prefix, sizeof(prefix), "%016llx-", (unsigned long long)scriptKey);
+	return prefix;
+}
+
+static void pruneBankCache(const std::string &directory, uint64_t scriptKey,
+		const std::vector<uint64_t> &pinnedKeys)
+{
+	profiler::Zone zone(profiler::Zone_DiskIo);
+	DIR *dir = opendir(directory.c_str());
+	if (!dir)
+		return;
+	std::vector<std::string> keep(1, scriptPrefix(scriptKey));
+	for (uint64_t key : pinnedKeys)
+		keep.push_back(scriptPrefix(key));
+	while (struct dirent *entry = readdir(dir)) {
+		const std::string name = entry->d_name;
+		if (name.size() <= 5 || name.compare(name.size() - 5, 5, ".bank") != 0)
+			continue;
+		bool kept = false;
+		for (auto &prefix : keep)
+			kept |= name.compare(0, prefix.size(), prefix) == 0;
+		if (!kept)
+			remove((directory + "/" + name).c_str());
+	}
+	closedir(dir);
+}
+
+static bool readBank(const std::string &path, uint64_t key, size_t sampleCount,
+		uint8_t *out, size_t bytes)
+{
+	profiler::Zone zone(profiler::Zone_DiskIo);
+	FILE *f = fopen(path.c_str(), "rb");
+	if (!f)
+		return false;
+	BankHeader header;
+	const bool ok = fread(&header, sizeof(header), 1, f) == 1 &&
+		!memcmp(header.magic, bankMagic, sizeof(bankMagic)) &&
+		header.version == bankVersion && header.key == key &&
+		header.sampleCount == sampleCount && header.bytes == bytes &&
+		fread(out, 1, bytes, f) == bytes;
+	fclose(f);
+	return ok;
+}
+
+// written next to the real file and renamed over it, like the font cache
+static void writeBank(const std::string &path, uint64_t key,
+		size_t sampleCount, const uint8_t *data, size_t bytes)
+{
+	profiler::Zone zone(profiler::Zone_DiskIo);
+	const std::string temporary = path + ".tmp";
+	FILE *f = fopen(temporary.c_str(), "wb");
+	if (!f)
+		return;
+	BankHeader header;
+	memcpy(header.magic, bankMagic, sizeof(bankMagic));
+	header.version = bankVersion;
+	header.key = key;
+	header.sampleCount = sampleCount;
+	header.bytes = bytes;
+	bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+		fwrite(data, 1, bytes, f) == bytes;
+	ok = fclose(f) == 0 && ok;
+	if (!ok || rename(temporary.c_str(), path.c_str()))
+		remove(temporary.c_str());
+}
+
+Compiler::Compiler()
+{
+	quit = false;
+	jobPending = false;
+	scriptLoaded = false;
+	scriptKey = 0;
+	patchKey = 0;
+	scriptStats = script.Stats();
+	busy = false;
+	loadedKey = 0;
+	worker = std::thread(&Compiler::run, this);
+}
+
+// a request made while compiling replaces any request still waiting, so
+// mashing Compile only ever queues one extra run
+void Compiler::Compile(const char *filename, const std::vector<Note> &notes,
+		const std::vector<int> &voices, int volume, bool compressed)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	job.filename = filename;
+	job.notes = notes;
+	job.voices = voices;
+	job.volume = volume;
+	job.compressed = compressed;
+	lastCompile = job;
+	jobPending = true;
+	busy = true;
+	wake.notify_one();
+}
+
+// joins whatever is waiting, so a compile that hasn't started yet renders
+// these as well
+void Compiler::Render(const std::vector<int> &voices)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (!jobPending) {
+		job = lastCompile;
+		job.filename.clear();
+		job.voices.clear();
+	}
+	for (int voice : voices)
+		if (std::find(job.voices.begin(), job.voices.end(), voice) ==
+				job.voices.end())
+			job.voices.push_back(voice);
+	jobPending = true;
+	busy = true;
+	wake.notify_one();
+}
+
+void Compiler::Preload(const char *filename, const std::vector<Note> &notes,
+		const std::vector<int> &voices, int volume, bool compressed)
+{
+	Job preload;
+	preload.filename = filename;
+	preload.notes = notes;
+	preload.voices = voices;
+	preload.volume = volume;
+	preload.compressed = compressed;
+	std::lock_guard<std::mutex> lock(mutex);
+	preloads.push_back(preload);
+	wake.notify_one();
+}
+
+void Compiler::RenderPatch(const char *filename,
+		const std::vector<Note> &notes, const std::vector<int> &voices,
+		int volume, bool compressed)
+{
+	Job render;
+	render.filename = filename;
+	render.notes = notes;
+	render.voices = voices;
+	render.volume = volume;
+	render.compressed = compressed;
+	std::lock_guard<std::mutex> lock(mutex);
+	preloads.insert(preloads.begin(), render);
+	wake.notify_one();
+}
+
+bool Compiler::Collect(Result *result)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (results.empty())
+		return false;
+	*result = std::move(results.front());
+	results.erase(results.begin());
+	return true;
+}
+
+bool Compiler::IsBusy() const
+{
+	return busy;
+}
+
+void Compiler::LastTimings(sf::Time *load, sf::Time *generate)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	*load = loadTime;
+	*generate = generateTime;
+}
+
+Script::MemoryStats Compiler::ScriptStats()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return scriptStats;
+}
+
+uint64_t Compiler::ScriptKey() const
+{
+	return loadedKey;
+}
+
+void Compiler::PinBanks(const std::string &owner, uint64_t key)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	for (auto &pin : pins)
+		if (pin.owner == owner) {
+			pin.key = key;
+			return;
+		}
+	Pin pin;
+	pin.owner = owner;
+	pin.key = key;
+	pins.push_back(pin);
+}
+
+void Compiler::UnpinBanks(const std::string &owner)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	for (size_t i = 0; i < pins.size(); i++)
+		if (pins[i].owner == owner) {
+			pins.erase(pins.begin() + i);
+			return;
+		}
+}
+
+static bool readScript(const std::string &filename, std::string *text)
+{
+	profiler::Zone zone(profiler::Zone_DiskIo);
+	FILE *f = fopen(filename.c_str(), "rb");
+	if (!f)
+		return false;
+	text->clear();
+	char buffer[4096];
+	size_t read;
+	while ((read = fread(buffer, 1, sizeof(buffer), f)) > 0)
+		text->append(buffer, read);
+	const bool ok = !ferror(f);
+	fclose(f);
+	return ok;
+}
+
+// the banks depend on the text of the script, not on where it was
+// loaded from
+static uint64_t keyOf(const std::string &text)
+{
+	uint64_t key = 14695981039346656037ull;
+	hash(&key, text.data(), text.size());
+	return key;
+}
+
+uint64_t Compiler::ScriptKeyOf(const std::string &filename)
+{
+	std::string text;
+	return readScript(filename, &text) ? keyOf(text) : 0;
+}
+
+// the collectors of both states get a step every so often until they
+// have caught up, the lock is let go of while they run
+void Compiler::waitForJob(std::unique_lock<std::mutex> &lock)
+{
+	bool collecting = true;
+	while (!jobPending && preloads.empty() && !quit) {
+		if (!collecting) {
+			wake.wait(lock);
+			continue;
+		}
+		wake.wait_for(lock, std::chrono::milliseconds(
+					Constants.script.idleStepMilliseconds));
+		if (jobPending || !preloads.empty() || quit)
+			break;
+		lock.unlock();
+		const bool scriptCollecting = script.IdleStep();
+		collecting = patchScript.IdleStep() || scriptCollecting;
+		const Script::MemoryStats stats = script.Stats();
+		profiler::Count(profiler::Counter_LuaHeap, stats.heapBytes);
+		lock.lock();
+		scriptStats = stats;
+	}
+}
+
+// keyed by the very text that was run, whatever happens to the file after
+void Compiler::loadScript(const std::string &filename)
+{
+	std::string text;
+	{
+		profiler::Zone zone(profiler::Zone_WaveScript);
+		scriptLoaded = false;
+		if (!readScript(filename, &text))
+			throw "Failed to read \"" + filename + "\"";
+		script.Execute(text, filename.c_str());
+	}
+	scriptKey = keyOf(text);
+	scriptLoaded = true;
+	loadedKey = scriptKey;
+
+	std::vector<uint64_t> pinned;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		for (auto &pin : pins)
+			pinned.push_back(pin.key);
+	}
+	if (cacheDirectory.empty())
+		cacheDirectory = bankCacheDirectory();
+	pruneBankCache(cacheDirectory, scriptKey, pinned);
+}
+
+// pinned again in case the file changed since; a patch that is still
+// loaded, unchanged, is used as it is
+uint64_t Compiler::loadPatch(const std::string &filename)
+{
+	std::string text;
+	if (!readScript(filename, &text))
+		throw "Failed to read \"" + filename + "\"";
+	const uint64_t key = keyOf(text);
+	if (filename != patchFilename || key != patchKey) {
+		patchFilename.clear();
+		profiler::Zone zone(profiler::Zone_WaveScript);
+		patchScript.Execute(text, filename.c_str());
+		patchFilename = filename;
+		patchKey = key;
+	}
+	PinBanks(filename, key);
+	if (cacheDirectory.empty())
+		cacheDirectory = bankCacheDirectory();
+	return key;
+}
+
+// from the disk cache when it's there, otherwise rendered and put there
+void Compiler::renderBank(const Job &current, Script *with, uint64_t withKey,
+		int voice, sf::Int16 *scratch, uint8_t *out, size_t bytes)
+{
+	const Note &note = current.notes[voice];
+	const int pitch = note.Pitch();
+	const uint64_t samples = Constants.maxSamples;
+	const uint32_t blockSamples = adpcm::blockSamples;
+	uint64_t key = withKey;
+	hash(&key, &pitch, sizeof(pitch));
+	hash(&key, &current.volume, sizeof(current.volume));
+	hash(&key, &current.compressed, sizeof(current.compressed));
+	hash(&key, &samples, sizeof(samples));
+	hash(&key, &Constants.samplesPerSecond, sizeof(Constants.samplesPerSecond));
+	hash(&key, &blockSamples, sizeof(blockSamples));
+
+	char name[64];
+	snprintf(name, sizeof(name), "%d-%d-%c.bank", pitch, current.volume,
+			current.compressed ? 'a' : 'r');
+	const std::string path = cacheDirectory + "/" + scriptPrefix(withKey) +
+		name;
+	if (readBank(path, key, samples, out, bytes))
+		return;
+
+	if (current.compressed) {
+		note.GenerateSamples(with, current.volume, scratch);
+		adpcm::Encode(scratch, samples, out);
+	} else
+		note.GenerateSamples(with, current.volume, (sf::Int16*)out);
+	writeBank(path, key, samples, out, bytes);
+}
+
+void Compiler::run()
+{
+	profiler::SetThreadName("compiler");
+	for (;;) {
+		Job current;
+		bool preload;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			waitForJob(lock);
+			if (quit)
+				return;
+			preload = !jobPending;
+			if (preload) {
+				current = preloads.front();
+				preloads.erase(preloads.begin());
+			} else {
+				current = job;
+				jobPending = false;
+			}
+		}
+
+		Result result;
+		result.compiled = !preload && !current.filename.empty();
+		if (preload)
+			result.patch = current.filename;
+		sf::Clock timer;
+		sf::Time load, generate;
+		try {
+			Script *with = &script;
+			uint64_t key = 0;
+			if (preload) {
+				with = &patchScript;
+				key = loadPatch(current.filename);
+			} else if (result.compiled)
+				loadScript(current.filename);
+			else if (!scriptLoaded)
+				throw std::string("No wave script loaded to render notes with");
+			if (!preload)
+				key = scriptKey;
+			load = timer.restart();
+
+			for (int voice : current.voices)
+				if (voice >= 0 && voice < (int)current.notes.size())
+					result.voices.push_back(voice);
+			// an arena of its own for every bank, so that the cache
+			// frees what it evicts instead of one bank keeping a whole
+			// compile alive
+			std::vector<sf::Int16> scratch(current.compressed ?
+					Constants.maxSamples : 0);
+			for (size_t n = 0; n < result.voices.size(); n++) {
+				auto arena = SampleArena::Create(1, Constants.maxSamples,
+						current.compressed);
+				renderBank(current, with, key, result.voices[n], scratch.data(),
+						arena->BankBlocks(0), SampleArena::Bank(arena, 0)->Bytes());
+				result.samples.push_back(SampleArena::Bank(arena, 0));
+				with->CollectIfOverLimit();
+			}
+			if (result.compiled) {
+				result.summaries.resize(result.samples.size());
+				for (size_t n = 0; n < result.samples.size(); n++)
+					result.summaries[n].Build(result.samples[n]);
+			}
+			generate = timer.getElapsedTime();
+		} catch (std::string &msg) {
+			result.voices.clear();
+			result.samples.clear();
+			result.summaries.clear();
+			result.error = msg;
+		}
+
+		const Script::MemoryStats stats = script.Stats();
+		profiler::Count(profiler::Counter_LuaHeap, stats.heapBytes);
+
+		std::lock_guard<std::mutex> lock(mutex);
+		scriptStats = stats;
+		results.push_back(std::move(result));
+		if (results.back().compiled) {
+			loadTime = load;
+			generateTime = generate;
+		}
+		busy = jobPending;
+	}
+}
+
+Compiler::~Compiler()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		quit = true;
+		wake.notify_one();
+	}
+	worker.join();
+}
+
@@ -0,0 +1,129 @@
+#ifndef COMPILER_HH
+#define COMPILER_HH
+
+#include "note.hh"
+#include "script.hh"
+#include "summary.hh"
+
+#include <SFML/System.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Runs the wave script and renders the samples of notes on a worker
+// thread, so pressing Compile never stalls input or drawing. The Lua
+// state is only ever touched from the worker. The preview summaries of
+// the notes are built there too, right after their samples.
+// A compile only renders the notes it is asked for, the rest are asked
+// for with Render() once they are needed, and rendered with the script
+// that is already loaded. Every bank rendered is kept in a disk cache,
+// keyed by the text of the script, and read back from there instead of
+// rendered again whenever it can.
+// In between jobs the worker steps the Lua collectors, see Script.
+// Patches are rendered in a Lua state of their own, whenever there's no
+// compile or render waiting, so the script everything else is rendered
+// with stays loaded; the patch script is only loaded again when another
+// one is asked for. Their banks are kept in the disk cache along with the
+// ones of that script.
+class Compiler
+{
+public:
+	// voices are indices into the notes of the job, samples and summaries
+	// go with them; only a compile has summaries. A preload has the
+	// filename of its patch in patch.
+	struct Result {
+		bool compiled;
+		std::string patch;
+		std::vector<int> voices;
+		std::vector<Samples> samples;
+		std::vector<WaveSummary> summaries;
+		std::string error;
+	};
+private:
+	struct Pin {
+		std::string owner;
+		uint64_t key;
+	};
+	struct Job {
+		// empty for a Render()
+		std::string filename;
+		std::vector<Note> notes;
+		std::vector<int> voices;
+		int volume;
+		bool compressed;
+	};
+
+	Script script, patchScript;
+	std::thread worker;
+	std::mutex mutex;
+	std::condition_variable wake;
+	bool quit;
+
+	bool jobPending;
+	Job job, lastCompile;
+	std::vector<Job> preloads;
+	std::vector<Pin> pins;
+
+	// worker only
+	bool scriptLoaded;
+	uint64_t scriptKey;
+	std::string patchFilename;
+	uint64_t patchKey;
+	std::string cacheDirectory;
+	std::vector<Result> results;
+	sf::Time loadTime, generateTime;
+	Script::MemoryStats scriptStats;
+
+	std::atomic<bool> busy;
+	std::atomic<uint64_t> loadedKey;
+
+	void run();
+	void waitForJob(std::unique_lock<std::mutex> &lock);
+	void loadScript(const std::string &filename);
+	uint64_t loadPatch(const std::string &filename);
+	void renderBank(const Job &current, Script *with, uint64_t withKey,
+			int voice, sf::Int16 *scratch, uint8_t *out, size_t bytes);
+public:
+	Compiler();
+	~Compiler();
+
+	// compressed banks take about a quarter of the memory, see adpcm.hh
+	void Compile(const char *filename, const std::vector<Note> &notes,
+			const std::vector<int> &voices, int volume, bool compressed);
+	// with the notes and settings of the last Compile()
+	void Render(const std::vector<int> &voices);
+	// the notes in voices, with the script in filename; queued behind
+	// whatever else is asked for. Pin its banks beforehand to have them
+	// survive the compiles before it.
+	void Preload(const char *filename, const std::vector<Note> &notes,
+			const std::vector<int> &voices, int volume, bool compressed);
+	// as Preload(), but ahead of the preloads still waiting, for the keys
+	// of a patch that is being played
+	void RenderPatch(const char *filename, const std::vector<Note> &notes,
+			const std::vector<int> &voices, int volume, bool compressed);
+	// the oldest result not collected yet
+	bool Collect(Result *result);
+	bool IsBusy() const;
+	// how long the last compile spent in the script and on notes
+	void LastTimings(sf::Time *load, sf::Time *generate);
+	// as of the end of the last run or collector step
+	Script::MemoryStats ScriptStats();
+	// the key the banks of the script loaded last are cached under, 0
+	// before the first one is loaded
+	uint64_t ScriptKey() const;
+	// the banks of the script with this key are kept in the disk cache
+	// even while another one is loaded, for as long as owner, a session
+	// or a patch file, holds on to them; pinning another key for the same
+	// owner lets go of the one before
+	void PinBanks(const std::string &owner, uint64_t key);
+	void UnpinBanks(const std::string &owner);
+	// as used for ScriptKey(), 0 if the file can't be read
+	static uint64_t ScriptKeyOf(const std::string &filename);
+};
+
+#endif
+
@@ -6,11 +6,12 @@
 #include <SFML/Graphics.hpp>
 #include "../imgui/imgui.h"
 
+#include <algorithm>
+
 const struct
 {
 	int updateMilliseconds = 16;
 	int antialiasing = 6;
-	unsigned int fontSizeGuess = 10 * 1024 * 1024;
 
 	sf::Color backgroundColor = sf::Color(16, 16, 16);
 	struct {
@@ -24,7 +25,8 @@ const struct
 		int outlineValue = 78;
 	} rectangle {};
 	struct {
-		int size = 19;
+		// pixel height the labels are rasterised at into the GUI font atlas
+		int size = 24;
 		int spacing = -1;
 		int outline = 4;
 		int colorValue = 15;
@@ -35,16 +37,82 @@ const struct
 		sf::Color color = sf::Color(30, 30, 30);
 	} line {};
 	int padding = 10;
-	struct {
-		int precomputedOctaves = 6;
-		int width = 4000;
-		int height = 500;
-	} noteAtlas {};
 
 	int channels = 1;
 	int samplesPerSecond = 44100;
 	unsigned long long int maxSamples = 2*samplesPerSecond;
+	// of every bank in a sample arena
+	int arenaAlignment = 64;
 	double stdTuning = 440;
+	struct {
+		int blockSize = 512;
+		// commands waiting for the audio thread, and waiting there for
+		// their block; past that they are dropped
+		int commandRing = 4096;
+		int scheduledCommands = 4096;
+		// banks let go of by the audio thread, until the main thread
+		// frees them
+		int releaseRing = 4096;
+	} audio {};
+	struct {
+		int maxSeconds = 30;
+	} looper {};
+	struct {
+		// next to wave.lua, every *.lua in it is a patch
+		const char *directory = "patches";
+		// of held notes, when switching patches
+		int crossfadeMilliseconds = 30;
+	} patches {};
+	struct {
+		// per thread; what doesn't fit until the next frame is dropped
+		int ringRecords = 8192;
+		int periodMilliseconds = 250;
+		int stripMilliseconds = 500;
+		// samples of a note per "script values" zone
+		int valuesBatch = 4096;
+	} profiler {};
+	struct {
+		// the Lua allocator carves its pools out of chunks this big
+		size_t poolChunkBytes = 64*1024;
+		// heap growth that makes the collector run in full, in between
+		// notes
+		size_t garbageBytes = 8 << 20;
+		int idleStepKilobytes = 64;
+		int idleStepMilliseconds = 5;
+	} script {};
+	struct {
+		// simulated time between two frames of --headless-bench
+		int frameMilliseconds = 16;
+		// times every bank is played through by --codec-bench
+		int codecPasses = 20;
+		// how much later a key may reach the engine under "slow" than
+		// at normal speed before --headless-bench fails
+		int keyLatencyToleranceMicroseconds = 2000;
+		// how long to wait for the input thread to take the last event
+		int drainMilliseconds = 1000;
+	} bench {};
+	struct {
+		// how often the input thread looks for window events
+		int pollMicroseconds = 1000;
+	} input {};
+	struct {
+		// what the engine can get ahead of the GUI by, in samples
+		int ringSamples = 1 << 15;
+		int historySamples = 1 << 16;
+		int fftSize = 2048;
+	} scope {};
+	struct {
+		// frames still drawn after the last change, ImGui needs a couple
+		// to settle hover and layout
+		int settleFrames = 3;
+		int idleSleepMilliseconds = 2;
+		int frameLimitMax = 240;
+		int cpuSampleMilliseconds = 1000;
+	} render {};
+	struct {
+		double bucketSeconds = 1.0;
+		double binSeconds = 1.0/16;
+	} take {};
 
 	int notesViewWidth =
 		padding +
@@ -52,11 +120,15 @@ const struct
 	struct {
 		int width = 500;
 		int fontSize = 18;
+		int fontOversample = 8;
 		float alpha = 0.5f;
 		int graphHeight = 40;
 		int samplesInPreviewMin = 5;
 		int samplesInPreviewMax = 22050;
 		float samplesInPreviewPower = 3.0;
+		int previewNotes = 5;
+		int previewPoints = 300;
+		int bankCacheMegabytesMax = 256;
 		int volumePercent = 16;
 		const char *VFCModeString =
 			"Linear\0Exponential\0Square Root\0\0";
@@ -75,6 +147,7 @@ const struct
 			ImColor modeRepeatingActive  = ImColor::HSV(150/360.,  37/100.,  80/100., 1.00);
 
 			int modeSpacing = 11;
+			int looperSpacing = 30;
 		} menuBar {};
 		float exponentialStrengthMin = 1.0;
 		float exponentialStrengthMax = 1000.0;
@@ -83,11 +156,116 @@ const struct
 			ImColor hovered = ImColor::HSV(0/360.,  40/100.,  67/100., 1.00);
 			ImColor active  = ImColor::HSV(0/360.,  37/100.,  80/100., 1.00);
 		} tabs {};
+		struct {
+			float visibleSeconds = 10;
+			float minVisibleSeconds = 0.25;
+			float maxVisibleSeconds = 3600;
+			float zoomStep = 1.25;
+			int minBlockPixels = 3;
+			// a draw list addresses its vertices with ImDrawIdx and every
+			// block is a 4 vertex quad; half of what it can address is
+			// left to the rest of the window
+			int maxBlocks = std::min<unsigned long long>(1 << 20,
+					(1ull << 8*sizeof(ImDrawIdx))/4/2);
+			unsigned fullDensity = 4;
+			ImColor background = ImColor::HSV(0/360.,  0/100.,  12/100., 1.00);
+			ImColor sharpRow   = ImColor::HSV(0/360.,  0/100.,   8/100., 1.00);
+			ImColor note       = ImColor::HSV(30/360., 50/100.,  90/100., 1.00);
+			ImColor openNote   = ImColor::HSV(345/360., 50/100., 90/100., 1.00);
+			ImColor playhead   = ImColor::HSV(0/360.,  0/100.,  80/100., 1.00);
+		} pianoRoll {};
+		struct {
+			int height = 90;
+			float minWindowSamples = 64;
+			float maxWindowSamples = 32768;
+			float windowPower = 3.0;
+			float minHz = 20;
+			float minDecibels = -90;
+			ImColor background = ImColor::HSV(0/360.,   0/100.,  12/100., 1.00);
+			ImColor axis       = ImColor::HSV(0/360.,   0/100.,  25/100., 1.00);
+			ImColor trace      = ImColor::HSV(150/360., 50/100., 90/100., 1.00);
+			ImColor spectrum   = ImColor::HSV(30/360.,  50/100., 90/100., 1.00);
+		} scope {};
+		struct {
+			// spare room in the buffer of the script editor
+			int minGap = 4096;
+			int visibleLines = 10;
+			ImColor text     = ImColor::HSV(0/360.,   0/100.,  90/100., 1.00);
+			ImColor keyword  = ImColor::HSV(210/360., 45/100., 95/100., 1.00);
+			ImColor number   = ImColor::HSV(30/360.,  55/100., 95/100., 1.00);
+			ImColor string   = ImColor::HSV(100/360., 45/100., 80/100., 1.00);
+			ImColor comment  = ImColor::HSV(0/360.,   0/100.,  55/100., 1.00);
+			ImColor cursor   = ImColor::HSV(0/360.,   0/100.,  95/100., 1.00);
+			ImColor selection = ImColor::HSV(210/360., 50/100., 45/100., 0.60);
+		} editor {};
+		struct {
+			int rowHeight = 14;
+			int minLabelPixels = 40;
+			ImColor background = ImColor::HSV(0/360.,   0/100.,  12/100., 1.00);
+			ImColor label      = ImColor::HSV(0/360.,   0/100.,  90/100., 1.00);
+		} performance {};
 	} gui {};
 	const char *defaultWaveScript =
 		"function wave(w, t)\n"
 		"\treturn sin(w*t)\n"
 		"end\n";
+	const char *defaultLayoutFile = "layouts/qwerty.layout";
+	// One command per line, "#" starts a comment:
+	//   frames <count> <label>      draw this many frames, timed under label
+	//   tab wave|roll|settings|performance
+	//   expand on|off               open every header of the settings window
+	//   mouse <x> <y>
+	//   down, up                    left mouse button
+	//   wheel <delta>
+	//   type <text>                 typed into whatever has focus
+	//   press <key>, release <key>  key names as in layout files; the event
+	//                               arrives as the next frame starts
+	//                               building and goes to the engine from
+	//                               the input thread
+	//   slow <milliseconds>         every frame from here on takes this
+	//                               much longer to build, 0 to stop; key
+	//                               latency has to stay what it is at 0
+	const char *defaultBenchScript =
+		"tab wave\n"
+		"frames 120 wave-idle\n"
+		"mouse 300 200\n"
+		"down\n"
+		"frames 2 wave-click\n"
+		"up\n"
+		"type local x = sin(w*t) -- typed\n"
+		"frames 60 wave-typing\n"
+		"press Q\n"
+		"press E\n"
+		"press T\n"
+		"frames 60 keys-chord\n"
+		"release Q\n"
+		"release E\n"
+		"release T\n"
+		"tab roll\n"
+		"frames 120 roll\n"
+		"mouse 300 250\n"
+		"wheel -3\n"
+		"frames 60 roll-zoomed\n"
+		"tab settings\n"
+		"expand on\n"
+		"frames 240 settings-expanded\n"
+		"tab wave\n"
+		"slow 200\n"
+		"press Q\n"
+		"frames 2 keys-slow-press\n"
+		"release Q\n"
+		"frames 2 keys-slow-release\n"
+		"slow 0\n";
+	// under $XDG_CACHE_HOME, or ~/.cache
+	const char *fontCacheFile = "sythin2-font-atlas";
+	// next to it, the samples of notes rendered with the current script
+	const char *bankCacheDirectory = "sythin2-banks";
+	// in the working directory, next to wave.lua
+	const char *defaultSessionFile = "session.sythin2";
+	const char *defaultLayout =
+		"4 Num1 Num2 Num3 Num4 Num5 Num6 Num7 Num8 Num9 Num0 Dash Equal\n"
+		"3 Q W E R T Y U I O P LBracket RBracket\n"
+		"2 A S D F G H J K L SemiColon Quote Return\n";
 } Constants {};
 
 struct GlobalsHolder
@@ -97,6 +275,9 @@ struct GlobalsHolder
 	int windowWidth = Constants.notesViewWidth + Constants.padding + Constants.gui.width;
 	int windowHeight = 700;
 	int volume = 5000;
+	bool compressBanks = false;
+	// of sample banks kept in memory, see SampleCache
+	int bankCacheMegabytes = 16;
 
 	enum {
 		Mode_Playing,
@@ -104,13 +285,20 @@ struct GlobalsHolder
 		Mode_Repeating
 	} mode = Mode_Playing;
 
-	enum {
+	enum Tab {
 		Tab_Settings,
-		Tab_Wave
+		Tab_Wave,
+		Tab_PianoRoll,
+		Tab_Performance
 	} tab = Tab_Wave;
 
 	bool playingOnKeys = true;
 	bool showDemo = false;
+	bool compiling = false;
+
+	bool verticalSync = true;
+	int frameLimit = 60;
+	bool redrawOnDemand = true;
 
 	std::string errorMessage = "";
 };
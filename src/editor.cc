@@ -0,0 +1,551 @@
+#include "editor.hh"
+#include "constants.hh"
+
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+
+GapBuffer::GapBuffer()
+{
+	gapStart = 0;
+	gapEnd = 0;
+}
+
+size_t GapBuffer::Size() const
+{
+	return data.size() - (gapEnd - gapStart);
+}
+
+char GapBuffer::At(size_t pos) const
+{
+	return pos < gapStart ? data[pos] : data[pos + gapEnd - gapStart];
+}
+
+void GapBuffer::moveGap(size_t pos)
+{
+	if (pos < gapStart) {
+		const size_t count = gapStart - pos;
+		memmove(&data[gapEnd - count], &data[pos], count);
+		gapStart -= count;
+		gapEnd -= count;
+	} else if (pos > gapStart) {
+		const size_t count = pos - gapStart;
+		memmove(&data[gapStart], &data[gapEnd], count);
+		gapStart += count;
+		gapEnd += count;
+	}
+}
+
+void GapBuffer::Insert(size_t pos, const char *text, size_t count)
+{
+	if (count == 0)
+		return;
+	moveGap(pos);
+	if (gapEnd - gapStart < count) {
+		const size_t tail = data.size() - gapEnd;
+		std::vector<char> grown(std::max(data.size()*2,
+					Size() + count + (size_t)Constants.gui.editor.minGap));
+		std::copy(data.begin(), data.begin() + gapStart, grown.begin());
+		std::copy(data.begin() + gapEnd, data.end(), grown.end() - tail);
+		gapEnd = grown.size() - tail;
+		data.swap(grown);
+	}
+	memcpy(&data[gapStart], text, count);
+	gapStart += count;
+}
+
+void GapBuffer::Erase(size_t pos, size_t count)
+{
+	moveGap(pos);
+	gapEnd += count;
+}
+
+void GapBuffer::Copy(size_t from, size_t to, std::string *out) const
+{
+	out->clear();
+	if (from < gapStart)
+		out->append(&data[from], std::min(to, gapStart) - from);
+	if (to > gapStart) {
+		const size_t start = std::max(from, gapStart) + gapEnd - gapStart;
+		out->append(data.data() + start, to + gapEnd - gapStart - start);
+	}
+}
+
+Editor::Editor()
+{
+	cursor = anchor = 0;
+	preferredX = 0;
+	widestLine = 0;
+	lineStarts.push_back(0);
+	lines.push_back(Line { {}, 0 });
+}
+
+void Editor::SetText(const char *source, size_t length)
+{
+	text = GapBuffer();
+	text.Insert(0, source, length);
+	lineStarts.assign(1, 0);
+	for (size_t i = 0; i < length; i++)
+		if (source[i] == '\n')
+			lineStarts.push_back(i + 1);
+	lines.assign(lineStarts.size(), Line { {}, -1 });
+	retokenize(0, lines.size() - 1);
+	cursor = anchor = 0;
+	preferredX = 0;
+	widestLine = 0;
+}
+
+void Editor::GetText(std::string *out) const
+{
+	text.Copy(0, text.Size(), out);
+}
+
+size_t Editor::lineOf(size_t pos) const
+{
+	return std::upper_bound(lineStarts.begin(), lineStarts.end(), pos) -
+		lineStarts.begin() - 1;
+}
+
+// not counting the newline
+size_t Editor::lineEnd(size_t line) const
+{
+	return line + 1 < lineStarts.size() ? lineStarts[line + 1] - 1 : text.Size();
+}
+
+void Editor::copyLine(size_t line, std::string *out) const
+{
+	text.Copy(lineStarts[line], lineEnd(line), out);
+}
+
+void Editor::insert(const char *chars, size_t count)
+{
+	eraseSelection();
+	const size_t line = lineOf(cursor);
+	text.Insert(cursor, chars, count);
+
+	for (size_t i = line + 1; i < lineStarts.size(); i++)
+		lineStarts[i] += count;
+	std::vector<size_t> starts;
+	for (size_t i = 0; i < count; i++)
+		if (chars[i] == '\n')
+			starts.push_back(cursor + i + 1);
+	lineStarts.insert(lineStarts.begin() + line + 1, starts.begin(), starts.end());
+	// the line following the edit was tokenised after the old end state
+	// of the edited one, which is now at the last line of the insertion
+	lines.insert(lines.begin() + line + 1, starts.size(), Line { {}, -1 });
+	std::swap(lines[line].endState, lines[line + starts.size()].endState);
+	retokenize(line, line + starts.size());
+
+	cursor += count;
+	anchor = cursor;
+}
+
+void Editor::erase(size_t from, size_t to)
+{
+	const size_t line = lineOf(from);
+	size_t newlines = 0;
+	for (size_t i = from; i < to; i++)
+		if (text.At(i) == '\n')
+			newlines++;
+	text.Erase(from, to - from);
+
+	lineStarts.erase(lineStarts.begin() + line + 1,
+			lineStarts.begin() + line + 1 + newlines);
+	for (size_t i = line + 1; i < lineStarts.size(); i++)
+		lineStarts[i] -= to - from;
+	lines[line].endState = lines[line + newlines].endState;
+	lines.erase(lines.begin() + line + 1, lines.begin() + line + 1 + newlines);
+	retokenize(line, line);
+
+	cursor = anchor = from;
+}
+
+bool Editor::eraseSelection()
+{
+	if (cursor == anchor)
+		return false;
+	erase(std::min(cursor, anchor), std::max(cursor, anchor));
+	return true;
+}
+
+// Lines past the edited ones only need another look if the state they
+// start in has changed, e.g. when a "--[[" was typed above them.
+void Editor::retokenize(size_t first, size_t last)
+{
+	for (size_t i = first; i < lines.size(); i++) {
+		copyLine(i, &scratch);
+		const int state = tokenize(scratch, i > 0 ? lines[i - 1].endState : 0,
+				&lines[i].tokens);
+		const bool settled = state == lines[i].endState;
+		lines[i].endState = state;
+		if (i >= last && settled)
+			break;
+	}
+}
+
+static const char *luaKeywords[] = {
+	"and", "break", "do", "else", "elseif", "end", "false", "for",
+	"function", "goto", "if", "in", "local", "nil", "not", "or", "repeat",
+	"return", "then", "true", "until", "while",
+};
+
+static bool isWordChar(char c)
+{
+	return isalnum((unsigned char)c) || c == '_' || (unsigned char)c >= 0x80;
+}
+
+// The state at the end of a line is 0, or 1 + 2*level + (1 if comment)
+// while inside a long string or comment of the given bracket level.
+int Editor::tokenize(const std::string &line, int state,
+		std::vector<Token> *tokens)
+{
+	const size_t n = line.size();
+	tokens->clear();
+	auto push = [tokens](size_t start, size_t end, TokenKind kind) {
+		if (end <= start)
+			return;
+		if (!tokens->empty() && tokens->back().kind == kind &&
+				tokens->back().end == start)
+			tokens->back().end = end;
+		else
+			tokens->push_back(Token { (unsigned int)start, (unsigned int)end, kind });
+	};
+	// level of the "[==[" at the given position, -1 if there is none
+	auto longOpen = [&line, n](size_t at) {
+		if (at >= n || line[at] != '[')
+			return -1;
+		size_t i = at + 1;
+		while (i < n && line[i] == '=')
+			i++;
+		return i < n && line[i] == '[' ? (int)(i - at - 1) : -1;
+	};
+	// just past the matching "]==]", or npos
+	auto longClose = [&line, n](size_t from, int level) {
+		for (size_t i = from; i < n; i++) {
+			if (line[i] != ']')
+				continue;
+			size_t j = i + 1;
+			while (j < n && line[j] == '=')
+				j++;
+			if ((int)(j - i - 1) == level && j < n && line[j] == ']')
+				return j + 1;
+		}
+		return std::string::npos;
+	};
+
+	size_t i = 0;
+	if (state != 0) {
+		const TokenKind kind = (state - 1) & 1 ? Token_Comment : Token_String;
+		const size_t close = longClose(0, (state - 1) >> 1);
+		if (close == std::string::npos) {
+			push(0, n, kind);
+			return state;
+		}
+		push(0, close, kind);
+		i = close;
+	}
+
+	while (i < n) {
+		const char c = line[i];
+		if (c == '-' && i + 1 < n && line[i + 1] == '-') {
+			const int level = longOpen(i + 2);
+			if (level < 0) {
+				push(i, n, Token_Comment);
+				return 0;
+			}
+			const size_t close = longClose(i + 2 + level + 2, level);
+			if (close == std::string::npos) {
+				push(i, n, Token_Comment);
+				return 1 + 2*level + 1;
+			}
+			push(i, close, Token_Comment);
+			i = close;
+		} else if (longOpen(i) >= 0) {
+			const int level = longOpen(i);
+			const size_t close = longClose(i + level + 2, level);
+			if (close == std::string::npos) {
+				push(i, n, Token_String);
+				return 1 + 2*level;
+			}
+			push(i, close, Token_String);
+			i = close;
+		} else if (c == '"' || c == '\'') {
+			size_t j = i + 1;
+			while (j < n && line[j] != c)
+				j += line[j] == '\\' ? 2 : 1;
+			j = std::min(j + 1, n);
+			push(i, j, Token_String);
+			i = j;
+		} else if (isdigit((unsigned char)c) ||
+				(c == '.' && i + 1 < n && isdigit((unsigned char)line[i + 1]))) {
+			size_t j = i + 1;
+			while (j < n && (isWordChar(line[j]) || line[j] == '.' ||
+						((line[j] == '-' || line[j] == '+') &&
+						 (line[j - 1] == 'e' || line[j - 1] == 'E'))))
+				j++;
+			push(i, j, Token_Number);
+			i = j;
+		} else if (isWordChar(c)) {
+			size_t j = i + 1;
+			while (j < n && isWordChar(line[j]))
+				j++;
+			TokenKind kind = Token_Text;
+			for (auto keyword : luaKeywords)
+				if (j - i == strlen(keyword) && line.compare(i, j - i, keyword) == 0)
+					kind = Token_Keyword;
+			push(i, j, kind);
+			i = j;
+		} else {
+			push(i, i + 1, Token_Text);
+			i++;
+		}
+	}
+	return 0;
+}
+
+size_t Editor::previousChar(size_t pos) const
+{
+	if (pos == 0)
+		return 0;
+	pos--;
+	while (pos > 0 && (text.At(pos) & 0xC0) == 0x80)
+		pos--;
+	return pos;
+}
+
+size_t Editor::nextChar(size_t pos) const
+{
+	if (pos >= text.Size())
+		return text.Size();
+	pos++;
+	while (pos < text.Size() && (text.At(pos) & 0xC0) == 0x80)
+		pos++;
+	return pos;
+}
+
+float Editor::columnX(size_t pos, const ImFont *font, float fontSize) const
+{
+	std::string before;
+	text.Copy(lineStarts[lineOf(pos)], pos, &before);
+	return font->CalcTextSizeA(fontSize, FLT_MAX, 0,
+			before.data(), before.data() + before.size()).x;
+}
+
+size_t Editor::posAtX(size_t line, float x, const ImFont *font,
+		float fontSize) const
+{
+	std::string chars;
+	copyLine(line, &chars);
+	size_t pos = 0;
+	float width = 0;
+	while (pos < chars.size()) {
+		size_t next = pos + 1;
+		while (next < chars.size() && (chars[next] & 0xC0) == 0x80)
+			next++;
+		const float advance = font->CalcTextSizeA(fontSize, FLT_MAX, 0,
+				chars.data() + pos, chars.data() + next).x;
+		if (width + advance/2 > x)
+			break;
+		width += advance;
+		pos = next;
+	}
+	return lineStarts[line] + pos;
+}
+
+// true if the cursor was moved or the text edited
+bool Editor::handleKeys(const ImFont *font, float fontSize)
+{
+	ImGuiIO &io = ImGui::GetIO();
+	auto pressed = [&io](ImGuiKey key) {
+		return ImGui::IsKeyPressed(io.KeyMap[key]);
+	};
+	bool moved = false, keepX = false;
+	auto moveTo = [&](size_t pos) {
+		cursor = pos;
+		if (!io.KeyShift)
+			anchor = cursor;
+		moved = true;
+	};
+	const size_t line = lineOf(cursor);
+
+	if (pressed(ImGuiKey_LeftArrow))
+		moveTo(!io.KeyShift && cursor != anchor ?
+				std::min(cursor, anchor) : previousChar(cursor));
+	if (pressed(ImGuiKey_RightArrow))
+		moveTo(!io.KeyShift && cursor != anchor ?
+				std::max(cursor, anchor) : nextChar(cursor));
+	if (pressed(ImGuiKey_UpArrow)) {
+		moveTo(line > 0 ? posAtX(line - 1, preferredX, font, fontSize) : 0);
+		keepX = true;
+	}
+	if (pressed(ImGuiKey_DownArrow)) {
+		moveTo(line + 1 < lines.size() ?
+				posAtX(line + 1, preferredX, font, fontSize) : text.Size());
+		keepX = true;
+	}
+	if (pressed(ImGuiKey_Home))
+		moveTo(lineStarts[line]);
+	if (pressed(ImGuiKey_End))
+		moveTo(lineEnd(line));
+
+	if (pressed(ImGuiKey_Backspace)) {
+		if (!eraseSelection() && cursor > 0)
+			erase(previousChar(cursor), cursor);
+		moved = true;
+	}
+	if (pressed(ImGuiKey_Delete)) {
+		if (!eraseSelection() && cursor < text.Size())
+			erase(cursor, nextChar(cursor));
+		moved = true;
+	}
+	if (pressed(ImGuiKey_Enter)) {
+		// keeps the indentation of the line
+		std::string indented = "\n";
+		for (size_t i = lineStarts[line]; i < cursor &&
+				(text.At(i) == '\t' || text.At(i) == ' '); i++)
+			indented += text.At(i);
+		insert(indented.data(), indented.size());
+		moved = true;
+	}
+
+	if (io.KeyCtrl) {
+		std::string selection;
+		text.Copy(std::min(cursor, anchor), std::max(cursor, anchor), &selection);
+		if (pressed(ImGuiKey_A)) {
+			anchor = 0;
+			cursor = text.Size();
+			moved = true;
+		}
+		if ((pressed(ImGuiKey_C) || pressed(ImGuiKey_X)) && !selection.empty() &&
+				io.SetClipboardTextFn)
+			io.SetClipboardTextFn(selection.c_str());
+		if (pressed(ImGuiKey_X)) {
+			eraseSelection();
+			moved = true;
+		}
+		if (pressed(ImGuiKey_V) && io.GetClipboardTextFn) {
+			const char *clipboard = io.GetClipboardTextFn();
+			std::string pasted;
+			for (; clipboard && *clipboard; clipboard++)
+				if (*clipboard != '\r')
+					pasted += *clipboard;
+			insert(pasted.data(), pasted.size());
+			moved = true;
+		}
+	} else {
+		std::string typed;
+		const size_t capacity = sizeof(io.InputCharacters)/sizeof(io.InputCharacters[0]);
+		for (size_t i = 0; i < capacity && io.InputCharacters[i]; i++) {
+			const unsigned int c = io.InputCharacters[i];
+			if (c < 0x20 && c != '\t')
+				continue;
+			if (c == 0x7f)
+				continue;
+			if (c < 0x80) {
+				typed += c;
+			} else if (c < 0x800) {
+				typed += 0xC0 | (c >> 6);
+				typed += 0x80 | (c & 0x3F);
+			} else {
+				typed += 0xE0 | (c >> 12);
+				typed += 0x80 | ((c >> 6) & 0x3F);
+				typed += 0x80 | (c & 0x3F);
+			}
+		}
+		io.InputCharacters[0] = 0;
+		if (!typed.empty()) {
+			insert(typed.data(), typed.size());
+			moved = true;
+		}
+	}
+
+	if (moved && !keepX)
+		preferredX = columnX(cursor, font, fontSize);
+	return moved;
+}
+
+void Editor::Draw(const char *id, ImVec2 size)
+{
+	const ImFont *font = ImGui::GetWindowFont();
+	const float fontSize = ImGui::GetWindowFontSize();
+	const float lineHeight = ImGui::GetTextLineHeight();
+	const ImU32 colors[] = {
+		Constants.gui.editor.text,
+		Constants.gui.editor.keyword,
+		Constants.gui.editor.number,
+		Constants.gui.editor.string,
+		Constants.gui.editor.comment,
+	};
+
+	ImGui::BeginChild(id, size, true, ImGuiWindowFlags_HorizontalScrollbar);
+	const bool focused = ImGui::IsWindowFocused();
+	const bool scrollToCursor = focused && handleKeys(font, fontSize);
+
+	const ImVec2 origin = ImGui::GetCursorScreenPos();
+	ImGui::InvisibleButton("##text", ImVec2(
+				std::max(widestLine + fontSize, ImGui::GetContentRegionAvail().x),
+				lines.size()*lineHeight));
+	const ImGuiIO &io = ImGui::GetIO();
+	const bool clicked = ImGui::IsItemHovered() && ImGui::IsMouseClicked(0);
+	if (clicked || (ImGui::IsItemActive() && ImGui::IsMouseDown(0))) {
+		const float row = (io.MousePos.y - origin.y)/lineHeight;
+		const size_t line = std::min(row > 0 ? (size_t)row : 0, lines.size() - 1);
+		cursor = posAtX(line, io.MousePos.x - origin.x, font, fontSize);
+		if (clicked && !io.KeyShift)
+			anchor = cursor;
+		preferredX = columnX(cursor, font, fontSize);
+	}
+
+	const float scrollY = ImGui::GetScrollY();
+	const float viewHeight = ImGui::GetWindowHeight() -
+		ImGui::GetStyle().WindowPadding.y*2;
+	if (scrollToCursor) {
+		const float y = lineOf(cursor)*lineHeight;
+		if (y < scrollY)
+			ImGui::SetScrollY(y);
+		else if (y + lineHeight > scrollY + viewHeight)
+			ImGui::SetScrollY(y + lineHeight - viewHeight);
+	}
+
+	ImDrawList *drawList = ImGui::GetWindowDrawList();
+	const size_t first = std::min((size_t)(scrollY/lineHeight), lines.size());
+	const size_t last = std::min((size_t)((scrollY + viewHeight)/lineHeight) + 1,
+			lines.size());
+	const size_t selectionFrom = std::min(cursor, anchor),
+		selectionTo = std::max(cursor, anchor);
+	for (size_t i = first; i < last; i++) {
+		const float y = origin.y + i*lineHeight;
+		if (selectionFrom < selectionTo && selectionFrom <= lineEnd(i) &&
+				selectionTo >= lineStarts[i]) {
+			const float x0 = selectionFrom > lineStarts[i] ?
+				columnX(selectionFrom, font, fontSize) : 0;
+			const float x1 = selectionTo <= lineEnd(i) ?
+				columnX(selectionTo, font, fontSize) :
+				columnX(lineEnd(i), font, fontSize) + fontSize/2;
+			drawList->AddRectFilled(ImVec2(origin.x + x0, y),
+					ImVec2(origin.x + x1, y + lineHeight),
+					Constants.gui.editor.selection);
+		}
+
+		copyLine(i, &scratch);
+		float x = origin.x;
+		for (auto &token : lines[i].tokens) {
+			const char *begin = scratch.data() + token.start,
+				*end = scratch.data() + token.end;
+			drawList->AddText(font, fontSize, ImVec2(x, y), colors[token.kind],
+					begin, end);
+			x += font->CalcTextSizeA(fontSize, FLT_MAX, 0, begin, end).x;
+		}
+		widestLine = std::max(widestLine, x - origin.x);
+	}
+
+	if (focused) {
+		const float x = origin.x + columnX(cursor, font, fontSize),
+			y = origin.y + lineOf(cursor)*lineHeight;
+		drawList->AddLine(ImVec2(x, y), ImVec2(x, y + lineHeight),
+				Constants.gui.editor.cursor);
+	}
+
+	ImGui::EndChild();
+}
+
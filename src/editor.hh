@@ -0,0 +1,85 @@
+#ifndef EDITOR_HH
+#define EDITOR_HH
+
+#include "../imgui/imgui.h"
+#include <string>
+#include <vector>
+
+// Text with a hole at the last edit position. Typing next to the previous
+// edit only moves the hole by the distance between the two, and the
+// buffer grows without a limit.
+class GapBuffer
+{
+	std::vector<char> data;
+	size_t gapStart, gapEnd;
+
+	void moveGap(size_t pos);
+public:
+	GapBuffer();
+
+	size_t Size() const;
+	char At(size_t pos) const;
+	void Insert(size_t pos, const char *text, size_t count);
+	void Erase(size_t pos, size_t count);
+	void Copy(size_t from, size_t to, std::string *out) const;
+};
+
+// The script editor of the wave window. Next to the text it keeps where
+// every line starts and the Lua tokens of every line. An edit re-tokenises
+// the lines it touched and carries on only while the state at the end of
+// a line (inside a long comment or string or not) keeps changing. Only
+// the lines in view are ever copied out of the buffer and drawn.
+class Editor
+{
+	enum TokenKind {
+		Token_Text,
+		Token_Keyword,
+		Token_Number,
+		Token_String,
+		Token_Comment,
+	};
+	struct Token {
+		unsigned int start, end;
+		TokenKind kind;
+	};
+	struct Line {
+		std::vector<Token> tokens;
+		// 0 outside of long brackets, see tokenize()
+		int endState;
+	};
+
+	GapBuffer text;
+	std::vector<size_t> lineStarts;
+	std::vector<Line> lines;
+
+	size_t cursor, anchor;
+	float preferredX;
+	float widestLine;
+	std::string scratch;
+
+	size_t lineOf(size_t pos) const;
+	size_t lineEnd(size_t line) const;
+	void copyLine(size_t line, std::string *out) const;
+
+	void insert(const char *chars, size_t count);
+	void erase(size_t from, size_t to);
+	bool eraseSelection();
+	void retokenize(size_t first, size_t last);
+	static int tokenize(const std::string &line, int state,
+			std::vector<Token> *tokens);
+
+	size_t previousChar(size_t pos) const;
+	size_t nextChar(size_t pos) const;
+	float columnX(size_t pos, const ImFont *font, float fontSize) const;
+	size_t posAtX(size_t line, float x, const ImFont *font, float fontSize) const;
+	bool handleKeys(const ImFont *font, float fontSize);
+public:
+	Editor();
+
+	void SetText(const char *source, size_t length);
+	void GetText(std::string *out) const;
+	void Draw(const char *id, ImVec2 size);
+};
+
+#endif
+
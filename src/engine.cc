@@ -0,0 +1,369 @@
+#include "engine.hh"
+#include "adpcm.hh"
+#include "constants.hh"
+#include "profiler.hh"
+
+#include <algorithm>
+
+Engine::Engine(int voiceCount, const sf::Clock *nClock)
+	: commands(Constants.audio.commandRing),
+	released(Constants.audio.releaseRing),
+	output(Constants.scope.ringSamples)
+{
+	clock = nClock;
+	lastActiveVoices = 0;
+	crossfadeSamples = std::max(1, Constants.patches.crossfadeMilliseconds*
+			Constants.samplesPerSecond/1000);
+
+	voices.resize(voiceCount);
+	for (auto &voice : voices) {
+		voice.position = 0;
+		voice.held = false;
+		voice.active = false;
+		voice.decoded.resize(adpcm::blockSamples);
+		voice.decodedBlock = -1;
+		voice.fadingPosition = 0;
+		voice.fadeStep = crossfadeSamples;
+		voice.fadingDecoded.resize(adpcm::blockSamples);
+		voice.fadingBlock = -1;
+	}
+
+	scheduled.resize(Constants.audio.scheduledCommands);
+	scheduledCount = 0;
+
+	mixBlock.resize(Constants.audio.blockSize);
+	outputBlock.resize(Constants.audio.blockSize);
+
+	initialize(Constants.channels, Constants.samplesPerSecond);
+}
+
+// new samples only affect notes started after the swap, whatever is
+// sounding keeps its old buffer alive until it's done
+void Engine::SetSamples(const std::vector<Samples> &samples)
+{
+	const sf::Time now = clock->getElapsedTime();
+	for (size_t i = 0; i < samples.size(); i++) {
+		Command command;
+		command.type = Command::SetSamples;
+		command.voice = i;
+		command.samples = samples[i];
+		command.flow = 0;
+		push(command, now);
+	}
+}
+
+void Engine::SetSamples(int voice, const Samples &samples)
+{
+	Command command;
+	command.type = Command::SetSamples;
+	command.voice = voice;
+	command.samples = samples;
+	command.flow = 0;
+	push(command, clock->getElapsedTime());
+}
+
+void Engine::SetPatch(const SampleSet &banks)
+{
+	Command command;
+	command.type = Command::SetPatch;
+	command.voice = -1;
+	command.patch = banks;
+	command.flow = 0;
+	push(command, clock->getElapsedTime());
+}
+
+void Engine::NoteOn(int voice, sf::Time stamp)
+{
+	Command command;
+	command.type = Command::NoteOn;
+	command.voice = voice;
+	command.flow = profiler::FlowStart();
+	push(command, stamp);
+}
+
+void Engine::NoteOff(int voice, sf::Time stamp)
+{
+	Command command;
+	command.type = Command::NoteOff;
+	command.voice = voice;
+	command.flow = profiler::FlowStart();
+	push(command, stamp);
+}
+
+void Engine::LooperAction(Looper::Action action)
+{
+	Command command;
+	command.type = Command::LooperAction;
+	command.voice = -1;
+	command.looperAction = action;
+	command.flow = 0;
+	push(command, clock->getElapsedTime());
+}
+
+// a full ring only happens with nobody playing the stream, such as in
+// --headless-bench
+void Engine::push(Command &command, sf::Time stamp)
+{
+	command.stamp = stamp.asMicroseconds();
+	std::lock_guard<std::mutex> lock(pushMutex);
+	commands.Push(&command, 1);
+}
+
+void Engine::FreeReleased()
+{
+	Released batch[64];
+	while (released.Pop(batch, 64) > 0)
+		for (auto &item : batch) {
+			item.samples.reset();
+			item.patch.reset();
+		}
+}
+
+// Into the audio thread's schedule, kept ordered by stamp since commands
+// come from more than one thread. Everything is moved, never copied, so
+// that no references are dropped here. Should the schedule be full, the
+// earliest command is applied right away to make room.
+void Engine::schedule(Command &command)
+{
+	if (scheduledCount == scheduled.size()) {
+		apply(scheduled[0]);
+		for (size_t i = 1; i < scheduledCount; i++)
+			scheduled[i - 1] = std::move(scheduled[i]);
+		scheduledCount--;
+	}
+	size_t i = scheduledCount;
+	for (; i > 0 && scheduled[i - 1].stamp > command.stamp; i--)
+		scheduled[i] = std::move(scheduled[i - 1]);
+	scheduled[i] = std::move(command);
+	scheduledCount++;
+}
+
+// Hands a bank to the main thread instead of dropping the reference here,
+// where it might be the last one. With the ring full, which takes the
+// main thread not coming by for many blocks, it is dropped after all.
+void Engine::release(Samples &samples)
+{
+	if (!samples)
+		return;
+	Released item;
+	item.samples = std::move(samples);
+	released.Push(&item, 1);
+}
+
+void Engine::release(SampleSet &patch)
+{
+	if (!patch)
+		return;
+	Released item;
+	item.patch = std::move(patch);
+	released.Push(&item, 1);
+}
+
+// whatever the command carries ends up in a voice or released, so the
+// emptied command can be overwritten freely
+void Engine::apply(Command &command)
+{
+	profiler::FlowEnd(command.flow);
+	if (command.type == Command::LooperAction) {
+		looper.Perform(command.looperAction);
+		return;
+	}
+	if (command.type == Command::SetPatch) {
+		for (size_t i = 0; i < voices.size() && i < command.patch->size(); i++)
+			switchPatch(voices[i], (*command.patch)[i]);
+		release(command.patch);
+		return;
+	}
+	if (command.voice < 0 || command.voice >= (int)voices.size()) {
+		release(command.samples);
+		return;
+	}
+	Voice &voice = voices[command.voice];
+	if (command.type == Command::SetSamples) {
+		release(voice.bank);
+		voice.bank = std::move(command.samples);
+	} else if (command.type == Command::NoteOn) {
+		if (!voice.bank)
+			return;
+		release(voice.samples);
+		voice.samples = voice.bank;
+		voice.decodedBlock = -1;
+		voice.position = 0;
+		release(voice.fading);
+		voice.fadeStep = crossfadeSamples;
+		voice.held = true;
+		voice.active = true;
+	} else
+		voice.held = false;
+}
+
+// a held note picks up at the same place in the new samples, so that the
+// two line up as well as they can while they overlap
+void Engine::switchPatch(Voice &voice, const Samples &bank)
+{
+	release(voice.bank);
+	voice.bank = bank;
+	if (!voice.active || !voice.held || !bank)
+		return;
+	release(voice.fading);
+	voice.fading = std::move(voice.samples);
+	voice.fadingPosition = voice.position;
+	std::swap(voice.fadingDecoded, voice.decoded);
+	voice.fadingBlock = voice.decodedBlock;
+	voice.fadeStep = 0;
+	voice.samples = bank;
+	voice.position %= bank->size();
+	voice.decodedBlock = -1;
+}
+
+// samples from position on, up to *length of them or to the end of the
+// decoded block they are in
+static const sf::Int16* readRun(const SampleBank &bank, size_t position,
+		size_t *length, sf::Int16 *decoded, size_t *decodedBlock)
+{
+	if (bank.data())
+		return bank.data() + position;
+	const size_t block = position/adpcm::blockSamples,
+		offset = position % adpcm::blockSamples;
+	if (block != *decodedBlock) {
+		adpcm::DecodeBlock(bank.Blocks() + block*adpcm::blockBytes, decoded);
+		*decodedBlock = block;
+	}
+	*length = std::min(*length, adpcm::blockSamples - offset);
+	return decoded + offset;
+}
+
+// Held notes loop over their samples, released ones play to the end of
+// the buffer, same as sf::Sound with setLoop() did
+bool Engine::mixVoices(size_t from, size_t to)
+{
+	bool anyActive = false;
+	int activeVoices = 0;
+	for (auto &voice : voices) {
+		if (!voice.active)
+			continue;
+		const size_t fadeStart = voice.fadeStep;
+		if (voice.fading)
+			mixFading(voice, from, to);
+		const size_t size = voice.samples->size();
+		// in runs that end at the end of the samples or of a decoded block
+		for (size_t i = from; i < to; ) {
+			if (voice.position >= size) {
+				if (!voice.held) {
+					voice.active = false;
+					release(voice.samples);
+					release(voice.fading);
+					break;
+				}
+				voice.position = 0;
+			}
+			size_t length = std::min(to - i, size - voice.position);
+			const sf::Int16 *run = readRun(*voice.samples, voice.position,
+					&length, voice.decoded.data(), &voice.decodedBlock);
+			const size_t step = fadeStart + (i - from);
+			if (step < crossfadeSamples)
+				for (size_t k = 0; k < length; k++) {
+					const float gain = step + k < crossfadeSamples ?
+						(float)(step + k)/crossfadeSamples : 1.f;
+					mixBlock[i + k] += run[k]*gain;
+				}
+			else
+				for (size_t k = 0; k < length; k++)
+					mixBlock[i + k] += run[k];
+			i += length;
+			voice.position += length;
+		}
+		anyActive = true;
+		activeVoices++;
+	}
+	lastActiveVoices = activeVoices;
+	return anyActive;
+}
+
+void Engine::mixFading(Voice &voice, size_t from, size_t to)
+{
+	const size_t size = voice.fading->size();
+	size_t step = voice.fadeStep;
+	for (size_t i = from; i < to && step < crossfadeSamples; ) {
+		if (voice.fadingPosition >= size)
+			voice.fadingPosition = 0;
+		size_t length = std::min({ to - i, size - voice.fadingPosition,
+				crossfadeSamples - step });
+		const sf::Int16 *run = readRun(*voice.fading, voice.fadingPosition,
+				&length, voice.fadingDecoded.data(), &voice.fadingBlock);
+		for (size_t k = 0; k < length; k++)
+			mixBlock[i + k] += run[k]*(1.f - (float)(step + k)/crossfadeSamples);
+		i += length;
+		step += length;
+		voice.fadingPosition += length;
+	}
+	voice.fadeStep = step;
+	if (step >= crossfadeSamples)
+		release(voice.fading);
+}
+
+bool Engine::onGetData(Chunk &data)
+{
+	profiler::SetThreadName("audio");
+	profiler::Zone zone(profiler::Zone_AudioBlock);
+	const size_t count = mixBlock.size();
+	// a command issued right now lands at the end of the block after this
+	// one, one issued a block ago at the beginning of this one
+	const sf::Int64 blockStart = clock->getElapsedTime().asMicroseconds() -
+		(sf::Int64)count*1000000/Constants.samplesPerSecond;
+
+	while (commands.Pop(&incoming, 1))
+		schedule(incoming);
+
+	std::fill(mixBlock.begin(), mixBlock.end(), 0.f);
+
+	// stamps are increasing, so everything past the first command that
+	// belongs to a later block belongs there as well
+	bool liveInput = false;
+	size_t mixed = 0, applied = 0;
+	for (; applied < scheduledCount; applied++) {
+		Command &command = scheduled[applied];
+		sf::Int64 offset = (command.stamp - blockStart)*
+			Constants.samplesPerSecond/1000000;
+		if (offset >= (sf::Int64)count)
+			break;
+		if (offset > (sf::Int64)mixed) {
+			liveInput |= mixVoices(mixed, offset);
+			mixed = offset;
+		}
+		apply(command);
+	}
+	for (size_t i = applied; i < scheduledCount; i++)
+		scheduled[i - applied] = std::move(scheduled[i]);
+	scheduledCount -= applied;
+	liveInput |= mixVoices(mixed, count);
+
+	looper.Process(mixBlock.data(), count, liveInput);
+
+	for (size_t i = 0; i < count; i++) {
+		float sample = mixBlock[i];
+		if (sample > 32767.f)
+			sample = 32767.f;
+		else if (sample < -32768.f)
+			sample = -32768.f;
+		outputBlock[i] = sample;
+		mixBlock[i] = sample/32768.f;
+	}
+	output.Push(mixBlock.data(), count);
+	profiler::Count(profiler::Counter_Voices, lastActiveVoices);
+	profiler::Count(profiler::Counter_OutputRing, output.Size());
+
+	data.samples = outputBlock.data();
+	data.sampleCount = outputBlock.size();
+	return true;
+}
+
+void Engine::onSeek(sf::Time)
+{
+}
+
+Engine::~Engine()
+{
+	stop();
+}
+
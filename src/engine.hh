@@ -0,0 +1,118 @@
+#ifndef ENGINE_HH
+#define ENGINE_HH
+
+#include "looper.hh"
+#include "note.hh"
+#include "ring.hh"
+
+#include <SFML/Audio.hpp>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Mixes every sounding note and the looper into a single output stream.
+// Voices are addressed by index, one per key, and each plays whatever
+// samples were last handed to it with SetSamples(), so notes can be
+// started from any thread without touching the keyboard.
+// Commands are stamped with the time they were issued at and played back
+// one block later than that, at the exact sample the stamp maps to, so
+// the timing between notes survives however irregularly the main thread
+// gets to send them.
+// Compressed samples are decoded here as well, a block of them at a time
+// into a buffer of the voice, so a voice costs a block decode every
+// adpcm::blockSamples samples on top of the mixing.
+// Switching patches hands every voice a new bank at once. Held notes
+// crossfade into theirs over Constants.patches.crossfadeMilliseconds, the
+// rest carry on with the samples they started with.
+// The audio thread never locks or allocates. Commands get to it through a
+// ring and wait for their block in a buffer sized up front, and every
+// bank it is done with goes back through another ring, so that arenas
+// are only ever freed by whoever calls FreeReleased().
+// Every block that goes out is also pushed to output, for whoever wants
+// to look at it; if nobody drains it the blocks are simply dropped.
+class Engine : public sf::SoundStream
+{
+	struct Voice {
+		Samples bank, samples;
+		size_t position;
+		bool held, active;
+		// of compressed samples, the block at decodedBlock
+		std::vector<sf::Int16> decoded;
+		size_t decodedBlock;
+		// what it played before a patch switch, faded out while the new
+		// samples fade in; fadeStep counts up to crossfadeSamples
+		Samples fading;
+		size_t fadingPosition, fadeStep;
+		std::vector<sf::Int16> fadingDecoded;
+		size_t fadingBlock;
+	};
+	struct Command {
+		enum {
+			NoteOn,
+			NoteOff,
+			SetSamples,
+			SetPatch,
+			LooperAction
+		} type = NoteOff;
+		int voice = -1;
+		Samples samples;
+		SampleSet patch;
+		Looper::Action looperAction = Looper::Action_Stop;
+		sf::Int64 stamp;
+		// traced from the key event to the block that plays it
+		uint32_t flow;
+	};
+	struct Released {
+		Samples samples;
+		SampleSet patch;
+	};
+
+	const sf::Clock *clock;
+	std::vector<Voice> voices;
+	size_t crossfadeSamples;
+
+	// commands come from more than one thread, only they wait on this
+	std::mutex pushMutex;
+	SpscRing<Command> commands;
+	// sorted by stamp, the first scheduledCount of them
+	std::vector<Command> scheduled;
+	size_t scheduledCount;
+	Command incoming;
+	SpscRing<Released> released;
+
+	// as of the last mixVoices(), for the trace
+	int lastActiveVoices;
+	std::vector<float> mixBlock;
+	std::vector<sf::Int16> outputBlock;
+
+	void push(Command &command, sf::Time stamp);
+	void schedule(Command &command);
+	void apply(Command &command);
+	void release(Samples &samples);
+	void release(SampleSet &patch);
+	void switchPatch(Voice &voice, const Samples &bank);
+	bool mixVoices(size_t from, size_t to);
+	void mixFading(Voice &voice, size_t from, size_t to);
+
+	virtual bool onGetData(Chunk &data);
+	virtual void onSeek(sf::Time timeOffset);
+public:
+	Looper looper;
+	SpscRing<float> output;
+
+	Engine(int voiceCount, const sf::Clock *clock);
+	~Engine();
+
+	void SetSamples(const std::vector<Samples> &samples);
+	void SetSamples(int voice, const Samples &samples);
+	void SetPatch(const SampleSet &banks);
+	void NoteOn(int voice, sf::Time stamp);
+	void NoteOff(int voice, sf::Time stamp);
+	void LooperAction(Looper::Action action);
+	// frees the banks the audio thread has let go of, main thread only
+	void FreeReleased();
+};
+
+#endif
+
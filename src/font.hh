@@ -1,462 +0,0 @@
-// Binary file embedded as C source using file_to_c_source.cc
-#ifndef _COMMELIGHT_TTF_HH
-#define _COMMELIGHT_TTF_HH
-
-static const struct {
-    unsigned int size;
-    char data[31410*2+1];
-} _CommeLight_ttf = {
-31410,
-"425a683931415926535904b704640003c7ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe065efb073dc7cf5bd6fb7737defbef9f6f9dd"
-"7b37cef7780e5f5075f7b2a3cd975af1de03af61bedf5ef87d6f62841f04f5b6daf9dd88fb3e7d77beb9eeddd80edf5ddec0c685ed8e7df7bd77832dee5efbefade7b8b53e63"
-"9f366fb6f7bdf766dafbe8a31f7df4cf9d77cf9bda7a096fbae226d69d8e9de4d4f4d33737ade8ba14f75ece9ecf571ddca79ec57d7cb7cebd557dbafa3dedbde3bbbbdf5f77"
-"d7aafbc7b6e3cbef5efbdf47a5f6cfbbb7763ee7b876efbefade13eedcb7b7add7d1def9bdbeed6772f57c75d1ef7ced7c7bb3dee6f4f26eeef9e3efb6f1f365d97df377c69e"
-"8e942a7df7de51e5f62db8540683edf3b429f7d9d69b3002f6e771f7ca28e3bcf9e79ee1547df7bef868f89e9df6a3c0001d2be21a84200990c4d1a004c00013260982698013"
-"23134d32032320d1a64064d00d340d0d34029fa98c41a4da0261184601a0013132602608da0980483444080013418899823400d3427a09846134608c990d3536990434cd464d"
-"327a268f24d192784d3d4a786aa7f884f1130127e49e899a93c010ca3c13d519a9ea9e311a8d327a8f53c93d354fd50688100026802004c4c14f4068013026981a994f694cd0"
-"c869893d11a78a7a629a6686434d09e86413268da988c53c094fd29b32a7fa011a9ed49bd4654fd53d8a8f29f9536d51bd53d8a9e9a9faa7ea69ea7aa0d3220840804c134026"
-"53c53c6a64d346a9fa0d4f213d47a49e2614f132329b47a0a67a29e2180a7a353d348da27a8da99a8d1e9313353c9a6a6ca6689a1ea68da8680f1468f4434c9a19069907a864"
-"049a92102009881913d46254fc1a6293d3109e47932869a4c9a789a53f46a1b44c4f462053f2680d14fd2353f408daa6c51ed29fa8da8f536532264f69a99322698cd50f6a6a"
-"68f4d20f507ea8cdaa6d3464ca794da00942211a0118209809a626994f409e8266899301a990d53f2620354fc2a799368a67a9a4c64d09a9f926c4c930d547fa6499a153fd23"
-"54fd0a7e99aa78d4da29e14fd49ed43451e989e8d46d537a694c7aa7e9aa7829fa9ea9e5133ccbeab1f3f2aa73b8ef467a7635648c1cee5665ded2ab2b572bde948555ccfbfc"
-"3f84fd461d6f3cf65d5e01d282fba178c0a181a2a78085f75697fb4c8a20924cf3322272e53900ca29fce710ecbc663eabc8472a115421f288d65b044caf2f74ff4aa4c93ac4"
-"dda6c5503f16b912b67e4a405ff9f70923adb0dba832cc48f0353bb53e2e6a070b0d9f79c7544f1952a1e5aa9ca32fb4e60c4b3045a51a80353803377a28776180ddc52647a2"
-"ab73108ff1996f8fb4e7eaf0e17416bcd3a2f4e94c9f987fa54bf2299420cc95ac997f8c269575d142381dfa40da38cf74ddc8b80e2e719666baf9d1544633debd3e6d222fc1"
-"f73f6009886a18460a69aab7d7fbc4b0c3366c94668aac2cee06f3246fb38bb70baa2317685bf0f3341f6e8fab8bc0eb578c380e41c0838307833b05108294a8504139e4cf00"
-"1393b20081399840885aad80c454f857c88d97f03904d23ed4332a23534164cb3c217df73476c027a0b8c4c970e9a8928b04408407463797a1a0b0b6decfb69e4f254a79ff89"
-"8f68dfd9e8b89bbb3c4bb8d7b0a9450a0ea3b3b6d9fd9acae890325c7ed7c97ce5329c3c9573fd1eb8f21c408a902881fb38cc5da9dde7ee81075da9aa52352345354a27d6ab"
-"e138c30e898fafe17e0eb1e62aa25a281394259c887d67d0e4b21d729e8692c9d58a078466358e194caaa227a384dfc76424fa1e8682e9182a08cf255c4f37eaeff87bec3bcb"
-"b599c861ba79912bd2d7fe1f7afbf769e6df7e9fa0cf5a81953e0bb5cb6e4b7d73edfd4ffd72d7edcdcd6e98a8323320660c02329eb9ccfb9490282f7583f4f1bf1e724bcff4"
-"b5762a6a6137228e7260a3328b0b1d4275a9bb797d8ac9714454d40fcefd9dffe37c2e2e398d1d4af6e7fdbc3876963daf4ad2b2c5439db23eca9c9d24df6680c297e1ebfdee"
-"9c3ec0465ea889f9febf5bdd00f217b0073c0dc44a611688b7408b32d73a6d6347f8c863c3da1169d4612b08c2f45c42f64bdb1c62f458ae2813fa843eb7ccf8684d15cdc2bf"
-"96b8e22003b65252888226c050ccc9c9cd438aa8d1a94a22c518a5aa96b251691b536310e04bb6f5d4f008782144ae37d3ef2f53ed2b6963152c5bef78be6da3beb84d7cff66"
-"7d975225d38f94b6270fa9a5f6a36f9ff276e7b7e5772daae4bb8669780714d06cd1ed81e3f917527d286186186173dfa37c532642ce036dd8ffd8f0ffef863280e8b6ea28c7"
-"b78bba0b6835332799b6a66dbfe3a377f7b3f0d333a9e6a9dcba7a5bcc7fe7c0c2fe903af7b9fc7add90e9916281e72d0e333be4f6e9f3bdbdf69d045898d047224ec1f9af79"
-"ed7b6ed7e2dfe0fc4deeffcb5e1f0747c8da65fd2a3d9f87b56bd7da2f64ff01d88bfbbeb9a0bc895a096a49836eaefbbbcf7df88b028b8be6ef1c6f972aa7d8168093d4aee3"
-"aae471b98df0afa9f7de23fe8d50ee4ed08bfea021fd2478bd57381ccd36d4a6c4625e8bb23cc17e10c773f72b7307a8b7a514a356c1b51bfcb6929ad342889c767dbcef4f59"
-"e5e42adcb1a9fc4fd46ddc736e102bbdb4018277278430c89b8333d60191c49cb5c2f77a10fd36d762736823050bcbf380f51203d3ee3dae82a0016ad54151c51380aa0a41ce"
-"897f4722001cef0b6a48f233e34fb3a30cc36fd89a46a1e4efd94ebbe37a8b4f4f3e8722dfcfc32a458a03041335149d23e61cff8b44ee921c94fe1e0564417aa7f59f7bddd1"
-"f21d24eed0fa5f4ebfc5f3d90f294433aa8861fd0604f51510a0a60d70bac101ae521c2c02d32fdc1118f31cbe7a92e28b5e1e36df19fcd44b4fe584dae3b686471b6ef5370d"
-"10879f6b400446298d01351c910cec022cc36e08aea37432c6fb7057c1842098fddf43afb3ee9a137553372f119174e1a7e66bb19e4001e7e1a70459d8f2dd749a0b358bbaac"
-"139d04ca0f775b1ba262bcc225f5596aae609091944aa80cc8492460ca44de93a769af5d86c5bf9752bf4169b574a0c64aa53a394c2dc1052e90dc4374c41373da6f8df33715"
-"93144e593a6f6773bff02c75c261fd47e896ee9ba3ec59f3b77571b7470d3c37e80b197c27dc9f747c2317065f84c84cfede5240d36a903df3c9b9da5ddcdc5381c3f8a2e860"
-"cb599940f67333b07a3ec72fa4305a889870c341a234bef2a2a99af157452a165155552099001c55045549c9581114528642538861c9be22a9b5ef193dd929604628a70db1c7"
-"d9e9340c57e1e5c1b20416e98aaccb824421a7fbf5e7783761c4be3e8172e8f7444b6758f47a0d27860a758fc55199fe7bc76074a7e757cd32df940695c0f2668a037bc1e89a"
-"5c6e4120da5e8c58c475573fbb535b7c5fe2e235e379edc6e2b05ec6d52e1a091a59be7ce51f93038a32f690e35015f159178f3ff667fe5936f6bf10c30dfcb32a438c79c655"
-"bc040fd665b1efd04c0124c6a66eb920bfcfedfb98ac80de6f6c6938ed3a169fabdc37a7653d79dfd243a4e56d9fab9d3246787e8a653490446caba67dfb2434a72b91bae4b8"
-"6be06be40dc1d6cdcc85fd661e279ac97e6c584117a6613a8513378b06b51b55a08e2b2e1db94633baabdf64a4c66fd9975d299c96c80d5eea8a1969841d46d3cf9d65872523"
-"a5fd3636e952eab1b1c239594be98acf145560babb7e236d7b7810271511369beb319a657a7af2a170814d50a8a8ca802846c11a8803ab332a90f735cea71189d81677c5926b"
-"645a6d0907919bd6fc9a1c52954a1ca70cab5caf49af4d5877dbfea9e60486b22c0b006aa3ef04cf2de1352f2dd0ba093efc1682934e82f91580645402d1146544f814fc30fd"
-"1b1bcc854cbec30fb39589e6ce365709f8d4b9f471e56614a44e75ba19cb36fea8067976d39306e61532ca668b96948ecc3276c8aa628c4f4a4778b198681262319509938726"
-"801dc82e3302cb33026ba3a280e7517029af8f9aebb7701d4331ea5d66a543d89917d40d973e8e05200aa2d8ad970955f4ee2df53a448b4a34211e15e818e22bb9b401502713"
-"484a115615fa31aafe9aec824b42a4c266405a641cf14c3088415709808809352001a8afe9241055372e4b057817f070a09b1f4ecd4103e98f239c983e7ff3c4b52d319824b3"
-"36a696c05b3442516c562088869d4412529913e0ea7e8ec7c41d0869202538f15e63c7443c7f9f1aa6f5c5ab31a5beea64bf829768a92d0cc045686b6979819963da9f7520a1"
-"09d5f5365ecf7d4c55ac2c5044079c34d3a5d6d6cb4cc241d521ed6322f462826ac04068411cbf963ea56e0b489b4bb060e2a8126f4bda50d10ec3d56a05080e1760611004bc"
-"960d0419ae97eeffb10ceac3832b433b9b50a2478c2a6b6313dd51973f6154866f90f4991a9190121f6e22b12281b88db41ab490b29963e41b40f3993474e05fd2b37c894644"
-"5edbbbf8b69038e804dceaca92b4edc33eced69eab8ce7b73e396d24864f603b0407d2244ecd63064555de637aa3344357633a961a2aea458462d0c94b2bb6ad143889cf7ae8"
-"cfe2b9fb5c23131b6d1a6edcd1e7b432848160777c6dfa7f5aaee7d1aeeb8faa8db33d974e8ecba6c976cb828b22d18a68959d454102f3eba1d89540eed69f40b49fa9686fea"
-"9133db4bab6c55ef91b2a1411384866e2706fa59a423e28451de5fb39eff3cc34f53052cf1e8e7686a3ab700f432543b3193453b5686e1af91036f1b62ad98d52451ed85f0d7"
-"491d57ba5e4caf383ae0eed3f5a249e8de4dd9065e4f21c4320e70dcfc82a82e31c061ebf6f16313a5a2b501ede0d513fc2c4ccf63b55697da5b1766c04feeb46b6aa05f6411"
-"f9b3ac847cdbc427b6ebbcb6dc07953f793e687091a75853978c963e959005e0de5df27e0c2d2f2762cda0a31472ea42b5e815b51a6a9a802a7be12c35ad65fa33783b92fbda"
-"c0c20e348ea52c1e5f3f588387fc70d74f64e0e77fe73e7d9447608bfd950c42154aea85cbea66b853286c55150cc8678bdfbbb04b1dd3e428b9157f62285f3ba728514243b6"
-"440ad21dd550efc39d319c661b4f5c0a29e50a12c0bbc320eb1ae80ca3f31bd3704ac6b66b024a08c54e0a998a04a5bd50cbd75f59a12be1cf4ba1c8192d6541a0170c538063"
-"ed83b6bb9a5d0e1dd59ee109674a425b0a13b536329648657aac73af5474a8bbe13f7cea0c87bd7def384240620c978b05942f920242119ea0de50feac9d6b62050971283128"
-"84159b8df83a7d367999950d25268083c920b4f582e18d34643aba815cf483510b5c21d1459c5c82e6be30b08d5e222c0ac28f0561454ed62376440bed08a4101ed4b2d7ce3c"
-"00b1813ec6ad78804dfe545aaf1859e9a93b6fa7c9400b0ef48179c3b620588714e823223475215f8a0c15b58df463e454095dc875f1ea532627028b6e2f4b3e76a1224296f2"
-"30aee1638635de79c7357afe9d3f10e552695704d3c2845a1c8fd7dbbcbd932d44100c4ca2273016437a951edf48b7561cd140060cd734197cf66bab2849a942e2c9208a50ad"
-"70167fa19db1495ae96c6493a32819723ce081b1acf31b6c0a092acddf8f72cbabfaffb5dd6fe2413d650040fc97c3b0b4a0b20cdce3c725ddd9e0f55890da2a931b164436da"
-"b5c596d61777d65b06e6552d445966af4b84de5f417c5111816cba79c1467977fe4e5c3b8e6a6cdf24c11605e9d1e4864da2eed1e25d799339f926df62b898ca53561dc9fd6a"
-"7551482358558dcbd414332060161a1c240bc40387d58887316265dadfd452885d6c9ac54d1b30d0d6d6dae94d593de952288489304c2beae2b8d5cef0833ea37697d9f11097"
-"a5e889e562bc18ecc75d4565d14291202f6058d77ac2fdda72c5b093eee64c7f584a9fbd24f64e9e92c25a8aa82100cd2cfef2776ab751181120753346dd6e335d8bd26213b3"
-"1ca1e9f9f56dfb2ee7527a12547460e2c4783c398d5b128c2a0af457a962890311422292110d80f4fe2b610c4e328686403bdb359f4629d36314fc434913aae61c096f492c7e"
-"03c0ca8387eb06b2fa5dd40f993cefc66b6babb3cfdf31d87f5c1bc07bd3ea7db73e2a8e7e6a3913bdec56effe5fc91bab60f4e9ffde9a0747b826fed4958a70c76bbc898599"
-"3c790b61c33e0ea27070a170653d9a5df7f08bb36ed477a6ed2a170951738eb140eeb87c3245ee80bd147cd4f5316feb6e117036d2acddfe3c9f1ff5f829ff01c15d3a04c262"
-"8542f51262cc49ffe3fdb11d85503108b147df3a4dfdc81b3df6ddc47dc9c443e06070be68e2a6a8e9921fb012a83344fa135c1379fd2efef387ca7da1a5b9f3fd1e93a66438"
-"c3a14950e4a2f51b52d680674ccf1b44a56136646745c2a19d319dd3fafc0ff97f3de830c872ae2414f4b260aec0fa53339c0c73403c6260e554bd7b8b6008d6e13881ff8e5b"
-"2fb297461cdce5ca5a809f1962075c247a728cad521ac2ba28928bc53e3aaae5ba2b888541ea3cf8dc7d787cdbcb1a5770adb0702e1027cc123f1d15db3a2a16e5dc30853ff3"
-"62e1650397f94fc9d4156be02f978d64602a297750de8f72642e85f1492d2ff61bb477ed612331319e9dfb3473d4f3e4259c0d8237dac6f1ee0071481877089a5ac6408e8883"
-"43235f07b1c97919af61492c8707edfd4534607054d104fe7eedcf1cd7e95c98062bf2d5f3078dadae43802f1282cc82a806e3b2d7dc9cbf738b7f81935b3ffb8592285a49ed"
-"1010446019806640cc6403927b9ced1bedced6d3bb6e84545b27a54e3ac67e20ec199f8324f22606ce67d28deba8ee31db30031f6221071fc97c604d221d08595400894308aa"
-"cfe2be463b568fc4a03ec2e0be28bc7fdf53efa95776dbc6d926ff79a698f21856c9f8febd6a31d1ed24fbe95aaa83a1aa7d68a7bbd0699e1226988b40efbb7a581176ec6e31"
-"6eb4ec54dcb372cabcaacc9f1a1720c91ffef850ce356de39bbbdd9f773a1dee9566b3daab07f767b6eff15e7369d83998ffb7b93303681b73e99d7bb0a823c6491d0ea877e1"
-"e6b4743dcbb9ee7d0bcb36f744b9ed8d9afa52a5a037be7c81c3d640ce65e131480a501c15e6bd165e0ca45715994b4e164b13e5f27a55070177f5bce82013fb28440ec6cf2a"
-"2b2b28253504b4f1205f695fe8eb7d1c209ec73904a856543aeea93ecf889f3d5f44dbbfa3772d44bf651b640aed3c973913ba0fd7ff8c422eae3eab75cbb2814b3b9d6ba1f8"
-"42472db8785b7a1c1eaea784bce80676527edf7a5c5f2d44fce69eb9028d9bb557ec7e8fde81d5bc6670661a82114516d5d566f1ade83a1c7c0fe0ecbad17c8a909667e7b075"
-"f5eaf4fe09fc912a33ae280620a58818853839199d541b583db92bcd6f41911f3ca92492d8a68a7645d379f423d3a0b8088f7e9ea80cd9754ee8c51a2d3fd12a6d4fb52e04f7"
-"ea53c502ceee7752b65a1f7deb3d765eafb3ffb168aa6bf137776413bef8a50f5101c9d74f6570054cd6dc5e9f562eecc7967658a6f93add1973f9ee5aa6edf43ffdfedda3f6"
-"fcaff776ff4bff9877bcaf2fbef8e85ff57ea576ee9c5590d9542950de77df080b06d209bd76cb1e538807dbb33fe000f27ae798c73b676303fc67d33205feab41790ad70680"
-"151410308e31c5043f9bfca207870b0ff3fe0979187daad4bf6ef35a9e8a436e77d3f21ab5587ec9735fa246297ebba2aa6ff37b3d88e52d27d5ebe5af869ca75e8b6ed699e7"
-"f36596acb8bdd6ed704999a7cca1b71f295e418c213bbb14634eca9645554447d5cf1e8d256bfd053f1e6b3ebc7dafe3dfd710bcbb14320c80c404d30294a52005058a0c58c1"
-"a42bfc0941d73298ac0455418918c8b04414188a82915d44a5904505516231882aa88be62a9820b058b3f49a10633f51a414271194cfd5f5f6b08a6c344fa8c09d4b37acd848"
-"09063d049d758b51df2af39ac099f30bf15c5fbbc7758cb69ff187760f26412068c1c3b82821629088b6b37606b51021a21e2ad6815602c2cef2ed2c57569e22d57510eaeecb"
-"9cf70315e15131800184805d0f6a59cb090084a500363ca21a0382c410c285fed217aaa01c667406b9b2ec60f18993745f6fee7d89893636d15712ee08cfb101524fd7ef963f"
-"d913a0bd2ad50c92202cfc7101eba93fdc601fb7183e2de9fc6aa9d50171f7a2b8eaca9b9a9f0c43498062490c05248b0882008c352836b5f6756eb90580c6284113ee321490"
-"87df087187572810ad293611f4dfb93b837271491e29e2781349f691ccb37de21c7640aa8aa84522414648b0d4c8ee2b710312162a7300c609100982110c8b236bb8ca09e35b"
-"cceab65302c98bc3eaa1e61c8ccc5fef8b1ec44551be2c6ddc70c208d78c1384cc40397fc86460a8578e2b48a64203e220c4a691646642a916d51aa23118082b229890c370bc"
-"d71b2ebb64fa5390967867968daeec8b06fb0f99b58fac806131441c14cb5884a0f0a492a1201d5ab4e855c0b28a411b3248425197147dcd1a9639c1dda835d8934102c0f429"
-"da8ee8bb83513b6d010dd66498e8ff2616ff2b664d3e0506c9c8ffa31751e66397215430264b5020883440d2e1b443d8b4e3d81e4b3c7ca473074eb18448248d29dcb00cb0c7"
-"b967966a70e027dc68cd066163133443876e7f2edc0e7326fbe67359fafbdb6e6dc4352fc330c2659a9b144c1964595b4ba30d589560e6b7a74da5829a498f91198d16f25d1c"
-"09b935f6c4a365250902907ed299e465999f47c8a000e75f47ed34021fa608c15b91ce1856b5035a5186b55d0c3a1935fa704042730ab9bbc74b6fff99c869ecb56394f629fd"
-"4be1a8b02612d3ccce142a98c173e7feb0cc3de3229852962504bc207da7ab905300bc6c3e808116b93f162c59007fecd97fcc2fe5a23a5e095b45e04eebbb5c1c6937f77732"
-"2675f6a8794f797919183d2d703b030b9c7023cec7af150aa2e8be352bca6ff3f2015887414ec50f9247f0a8891290e5ba6263c039de0a497112889615a6029a0860077b90e3"
-"9e87fbadffb8ac814715df5bb9d3264624058fa8e546cd706bed94bf349897bc64bd106c4b8618a4305aa7e8306e9404b5cf27140ceff58ad2ba35af8770589f7bbbf5285e9a"
-"c0b4066f1ff6349112887a10e9f12b2c55e88ce98174a0601d7191b269b35687c728894ffb3f1e9243823d742f179c3e2532392e6809af2f89a1e67f897bc347137c6598dced"
-"9e59eed16b5f7519bc57425892328bfa39fbd629e26e57c6fb4fc8a725dd9d9e21fed3b7e97279c827cf4fbb7d787287ae5ee5e794903c41419911c6c4b9b2d870d084bd17e9"
-"227a950188c71c0cb0a0d7c2830a193e15d8b88205810edc718010cc581b3811e1fd4c3977fe867bf4f8bb27e8eb91ce85974f49502c951e2d9c5a275292631257f3ce50c256"
-"512d1a5d9e41a036c6723b8ebdd1b6b3e43ca87b1e777202fafabe5c0fd90feef298fd7f0ed58b032ae065926547834f6629177c8cfda623cae48fb74ee852b3afb15f8b17b5"
-"f477fd114303d5ff8a7b5a22a81445cc2f478fd74add6909913cdc9dbeeedde4c84560e0ed8f3178dfd7e9e18b0978a8faf0eb061184e9f4e7bcd4e5b1c38fd294acdd5f624c"
-"92bc5dc6a25769cc301af89d3bb69451412041c676ad0ab1eba9472302be58bcfe2d89ea4a34d8549f561a9bdd0dd2ccf47f6f947ff7ecc4b3455dddaef56eabc36f79bdc839"
-"d426d6b6e612c93a2831b5184e003cfb8319d9e91dad30448bba352f9d541017e05eb160cf68eb70d0ab6e4b9549f490f3a49d4228e23d274569499feba90f829a72864620a3"
-"01cd603ba088943fe9faae0f74dce1f94dbd94f5682d98f2ba9c437fe0dead9ac5fb94609f2b367ea27dcf6dcefd6d7eaf0d77e1c33d9eafe38ae06da062ae8a692ce53540eb"
-"58cef97b21682018b94302094289ff2b41c4fa174b186096625c77739e8ea60c100a8ef6b3c387a25ba2320aca02af3aedffa697b7f3fbccbc341f33c25de0ef7d964c3632ee"
-"7b686e6bb9d47f0e4d83301e0f014d1579e41e21bd0c694a50841d228527f831c0f19128a9d7daed0f2108d18530166be6fcd34afebaa4be3decaf6a0ee26aaf07dce03813af"
-"adb877db7aecddd211ddd44ebab14de5639bc844676aa10ff6372ac4f290e6dd6f8bc24db9f33b2c518ebbed3e172d96dc5abf8c5693277ad1dbc878193e533bbcaf0fb1bf65"
-"65f0fdb25dcfe713a0a855de75f867eda378538b55a5ec544e4df34842105e1fd7f22b706880fb5d425e2bf95a1affa22bda17cc4c75a4039653d0cdbbf2048c73527d3a6ec8"
-"b6ca6316c9f260924ea132bfc5336d21d0accbf316f4b35dbdbffae0f7fb1cd1d0c650cf36577e551a891583a49ead1a7ba984f0bc698889872f4cae39b6bf0d69b8bf756efa"
-"9be7c2b93a854a95ab55b7addf5560f21deafee7f77fcba58788e9eb9cf8367ea844993a2da4ef2202fa96356c5100212ebfa583ce5839e8587e52cbd62f2736884da2fdd68c"
-"0c545c3228ded65a0dee35b1453ff93df7e77642c60a7bcef2b593f2bbcf97e9739385d999b1ec514c4146fa275247a10840a9e4223e6f39d138800b5dc72cfca5c098458807"
-"481087b52c8800e014746301616620cd215ae24126bc49268e861d34fbb510449b2d1352199f0982d07a5dcaeb71f1b55f0e400f99dadedb4d4854b01e017f1ee791c9e9bcda"
-"4061a135f9041e8df2d523c616d1de2d954d4b578afdfd1d005bd676bdaf1485f586b53fd63f34c18f31b31bfb2ca6c7f9836e8af5bcef2ffee3a3e3eefc1c7fcdfbdc9f95c9"
-"32f36d47f2546965552b49430aa28622d0606a1d973fc0abea74cdf73befe8f4ed39bfcbda9df265be5715a8202aa2208bf929b95cc8c6290a0c018a0c199c175cec03643d5e"
-"c9ff758fd0d0e0b7d8cea79b3cbb8ffe3bce4cb2ed039e0739eedc43ae90cfa4fc13a6fbf620ec05d7a51ab476ff58661f5b4ae6443fcf0b8c0fbe2ba7e5a44aa6dbd1e6f9fa"
-"d58bcfee8b21c68bfa407b29cad5968db2e27bd8ee99b3fbf80f65141663e94dedab1f8f39aaabae78ef5cf2d2cca33e3297867c927f9cdaec67362e35e5f2abe2b5161a57e3"
-"ca696252b7a9e85b6bf98d0e5ebf09e153b81c1c52e1f7893d01f6a444266ee929879300e0cd7cb1a4fbeb6ef66b4e930dd9ece60ea5c7e8977a926ecc53d4b77890d8c8a6ef"
-"fd42e15ac69de35139c45ced81ed6cff8fb69137fcc8bbecbdbef8a6afbf4e86d351a2ffa5994d708408e2797ccf14aa411c0a47305ef00fe0f7b5cbf2661b0c31a609e3c7a7"
-"727f1fc030f979d8eb213e3e40b2183305433b162b4c2af968687d91346c18987c361170f65412e520218c645090b861f890f9f93faff8ff210fd5f5d6644f33c7fb59b40d57"
-"85a52b1ddadebb4692d09b2e7fb10134a3565137c69ffe8e891c15ecca28f8901c1f795f5e829e329ee2d45c2c724028999d66ef7ffc9dbefe137d8631ddf895905228690ce6"
-"2a6b5d0ba3035cdb85dd1605e600b15669940c1853118ac451411505588ac5569a051111114d3dbfe2ff965d3c989c558fb8d4f0cc58f2700dc632bc4eaad998f63b18a6ace4"
-"8e242211688a4438a14e97b34a3864c508828f09240d57f56fb4bea6cb16b654a0f0311a08050b0b28323370da6c481c0db62f356d00d619400301739c2a44a6ade6f348c506"
-"26a324c33e6718ec690394b1a9a4525ddd5da90bff93f630ad4cca1281d3201549279f349d00440e3fe5084c0cba4d8509fc9ef67a137e684322527c6624684395fc731ef042"
-"254d4ad6fef6c62a5ef47faa47a73cd1ddccbe3247dc7736e705a71a651286a191049d525148c7885561212b3f9769c4f220cccb8dc264edb61d7f3be1eb27bce6569da2f2c4"
-"7791c2004e8f4d3bde21af7051c5ede15b93cb828fb9885853f052dc999e189b2800332d0998371bcaa7a5e970d13632d13e2a9c529d18802a20504a04bf7f68bddfa6ef0f38"
-"d498220f0140100b45aaee20c7a9da61340cc13d3048131cec471e64374c05fc61e2b35f6f7aba9eca3ff6799440282dc71c7cfd66b5c5402b847559023a448b9b64c0a3eae4"
-"2462099538ddcfae07c4551e8e8aba3cf3252596cd4ff434c8f90cbaba14e6d3ea1de72393a99ff1371f8db73231da2cd748f8e7f9030e34cf728491fd2fdfecb15e4310aac0"
-"0a2e9b43e0bde29f76aa2279a19bc4f94390e2790fbba773dc616051ca5d56b55287eceeb6ae945874753a7d64e65703efad201959d73a4fc44fb82e79dc1d12f61da72a8ba4"
-"ae9ace1cf1b20a875686dd21ddebbaa02c16069e15755264778d175ab65fd6a96ceb8a55cd9d9f62b990d1cc5a4be682b16eba5be412b3fda17a6f5d5f0e0b8df5a8495ccd9b"
-"8cd12279f16e3d0e0229c68cb094ece9a61e4fa72df815fdc336df9350b1f24b8e53f3cb5943294a503e14be5fe6f6d8888082cb9bf513a18f5ecfc392767f829052da523758"
-"8b287eba01fa8a8a3587fcd5f15a2fa2ef32e12199ebfaa0261fdfac993b14f776781963020ef6d91df9ff46b5e7f4e1a28cdaeff92bef14113fb1c20f7984d359d777a5dd31"
-"0743674f8568a3876f317cb83f6f84f08d11a8cb7a3cc4a729018a4077e052c81409614413dd757758e1de008c865403279a0a9830ec586364c7969be892bdb15033e44b2884"
-"58a7f5166088b365b05280cf140b2c56be430d9ba220e7d8439091ad79e3b8e6df858bb04710f2907c35cb04ecec149d25ad675b0c3a14cae89c13836ea9d0193671410c8394"
-"129e214ec6c19147fc9f03a152957b8183798017ef86bca3b8e9bfae7b605ada2efddd9c0a8f7a2d45d3426d3530d12fb3f981ff7a9e3934ef34c064b4c8ae37d9dc787eb33e"
-"067e2a84c4cc1a153eaa4282c552aab20a2a65aa48a00a02c13345c5c3c80a3c99bdff5f3836b5ff458167b6a496179ae146b365b1ca6a2e3da219dadfcd48721623733bbfc3"
-"5c532b3f84b8d156ab206369b85444a2a827281b2fb491d725905ca2cbb2805d19016738f750df1bd079bccf5f7f92b9611070c8b1e424045277d070911c0b00603aa3556e3a"
-"4cea5994f52915b25b182ad26ad681fd2c1795bbce03c84c8162443249cfca7a510199030147fddf2c00bd04de4543c68d36437acf7fcbd7104cfae1eb48c3afc2b29945e8ce"
-"de59ad6efbd69046c0eb1e6724441fd8686c3811a823f4f45c9001382bbfbb44a9350e974803f6c2f8c461b8457ae11a046a3718ec7def73aedb72b83eef237aff910e0e1d04"
-"22749d04a3159389757b9d985e9b5c892c588f7df2fe0dd7fd9f95f3375fc5fcb3a0c38bca21c65052efcc12d93d8bbc899905d024e61048709db9a10872f2f9dc8caa01226d"
-"daab09291e6e6f188f9bfc1c1af8b43cbb0eed8355d45291afa274fe0f87503d3a7fb69266e8eb2905245571b357c2b897f9af379acf4db52aeeb1db098e9c938e23e1d0842b"
-"2fef524f7e45b1bb12cb9d9c1fa425ffc2e7dbd8f59f17a6b2f7e828b8a26e25f7afaf787a3e5bff0c4a4e24c72bd374a9374dc704c464f30df05e3910427447348226b1a8ee"
-"28b28667f53ddbc9bcef6462ae51f8595eb32600fcf3ecae9abbb2ff85b09f7fee6abaf6b036320a591e7820d7c127f74f7152bbaa6443714b53eaf8df368f5d23dc14134a7f"
-"69b012b413a613703bb073eaaa46ffe33a7f204849e8f304163d684420504fe5bd81819ee27d40610c962f43f2fda0dbaa750b766b103bc931ba624fde3fad2160b21b82f959"
-"d74bd0bbd08903477546b01bd8ff2e8d97dcc4efdd9083f619d9565b9408706fe7b201db13439228748bd4a6793088008110c0f734081241ef90901aab956c7a338f0f1df8ef"
-"98b090d81acf2616c25ff1faf7c2cf3366924c6ab108c9e2f5879bb5c33354959dce583e16fd9e8f947e648d8a949f71973371bbdcccee077d92d9c570d211872f3cc6312342"
-"37c359efc59c8cdaa803965b1121707a6ed22a1e0df7bb11a5fdfaf721da42d329d71507b96585e0c719d7aa1c8eeaeec32356487b747050c70a3c1271cbd1de6ff95ded659a"
-"cfc0ad71defd0dd179e387dccec7cdefbd4214c62887337a88c40dd54885aeddcfa6ad26733baa96dd6b9ce34be773557b6c0de52750f0d9c2a8b47ca186ea176e686bbb4d1d"
-"d7661e006b29cd37ff5ff2fff1a972edd138330202943cf0e9db9b5b9128e0bd146b651fb9e1287f82de183b94036b3d47db2405310768bf9c13a7062abebd1b2087907b2b33"
-"e4a3ad4f9468ece7f5191069bedaa7f33dfc52f71ffe6fa9ee5e5d80e36be142ef5aa55689f654603e77ecb383abcce4bf9ca467d54e9abc48e104159c5159080f4f9f77673f"
-"b2a4fb8eb3812a56d32f13c54c550cc42ca23d680e307046205a3c8e4b8120c9bf6b092261a6afd7280524524294798e8ca865d77e26174a7a538ad952806042f92218d3ea22"
-"9f2394bd148500492168d6b9ba3cc42079a5cbbe7a14b0a98cf9e8da5d6c71629f68a79b6967ab3efbe385323402acfeeda29b4cc52e7efaeb295aa6d0ffcbb04d1aed3ad570"
-"a5cb28f1000cea0c9395d2f759aabcb181c134246c2c3ed23567cd6a87acefefe5ebdb3bb8f5b58beea5773fb19bb79fdbc7f474dc0234116ef44ca9b2c93214b88790ecfb85"
-"86a9ffd80e00a53f890b977d848187b47c3fcf84fc9a837402d32835da83ddd9dbc5b3bcf698da9c0a1f413f35100302faa7c2f3f5bfa45831b5302b48739b27a930c8c02758"
-"d8ff1b7a7096526a88acf827064b5a245850d0941eaeeb1408c7d6b10837088c8c2aadd414b3c89e586cfc4f36c37f1e9f3838725d11a38de7792f964540e77d3ccf861ec68a"
-"201e16605e44265b3a612b643e372302a4f3155acc2e8d84d7842d3ac2b537ed1730803af43be8449bc34b0042f449b5582065499a43bb5563830faae7adc7bc617c1cc9454c"
-"496c790d69a04ba4fa78144451443fcbec3c38df5f8dd878f5c28b93e324b9d40b01650c68784c28aa8180b5905058f6d43cc3cd1d298568f537a21210990f17a9bb084891f9"
-"0c6a8f218b3f21f2bc3dfbcf3f52748520d10e6c9c3c948ccf75d4eb75b45a9b2f9a9b867abc41b738e3d25821e97824462bef9d85f40692a2212ccb6718d72d150cd47858e1"
-"3041486229a00c033332514463f09a86faa52d5e5a473bed7fdda0b3ab492f61dd200b3c48bac9aa6f311397f99bfd5df9f913c04c5e73b9a0a62ac52dcce23f035585df670a"
-"e9b4b11aa4018ca42141516e90a0a2c7d025d96e7a57b9cc7edaf2aba75e8c35f6d0243c8fb881a1737340f74309b951bef324c248f7fc120ff88d49679619bb0c2da55be0c8"
-"353b767957016355164aa8181016417fa320873c821fc9d14836b7a02a529e0b618c54f8d8d8515efabf3198676eca6eb49b0cfcc88dae927e2e5acd95f03e4e7b6b0412ede5"
-"46dff19dd88ee5058d8c09d64cb1077dd4e2514fe53adc89da283d61c559678cd6d0dbf2efc31613bf32b31548c4181cc4a8dbdf3c549a872c7bbcfdef11b9836717424f182d"
-"69247b3abc6ff0191f0e3a9e4e5dc6df12c1008198c4a294be9fdfc2784375c9e185bfa7de7fa3f95ac0c28dfa2f4306df65e4dba0ffb5fbf8488a3104390bbcbabcffdd8b9c"
-"378af19dccd7dd50726343a76e2cda424fe2f702d076f2dfab88e9c5d1676ce99894cafabf24ab2924311d17b66ecd661ef052bf64ae218607af4509efe0d564d7c1e2671a75"
-"e7697d1b470dae5c590d35aedaf6d2c61c5c1c1c9cb6f7848037ee33f5eff25063162a5429c41ac32dadef64ec56df393b5c9c0b12969a7ca26081e821b3c9f4f3dfd065eace"
-"8aac4ba24e2b6f3250b3aa10af43096483108a451641458858aa41108b0582822114918c062c5183058c46223911a16720e441a8321bcde2aaf63b9515526f8236ec8fa57c27"
-"3a444857f77bed2673bb9a73e3cae677d18d5185af87cdf088ce5b3aacf026d98468eb344681624105114f9398e6c0ef2f9db04ac7e5937272899c21b4b8b1e34f6bc9a11070"
-"4a771d78f1aab02faa8630e8679009f13852192b19b97babf96bd9e06686b7c836430b6d1760150f211e1e3f1b69c775e14b235e35be366e7e14b8dd44c4b0ec564126bf4b30"
-"3b0039cc64d52c481f1f9141c1d8303564d1d2910ac7ba07ba68f7a18c417bddab57ccd01f5028c6570a934d5d170f4f7fb571693351665ad343ed4454de300f44c0540557af"
-"9becc03f519facbcc2f56f3ded6f2387156a6f5bacde3392ddc37f7e2cd3fc0a6c0c1c4b9ba78bbbbec2c4f9a3d08b115d1a5b48af1e3b77d7ec350c3aa6660b826661be8ec9"
-"093302b4fcc0ccdb346bfcafaf8ffdf73b7fab2645c87054a3d373fb7c5bdf9a5f1af797bca8ce358156d6e6e45fdd5a0ba11e0338cdf80f3ecef5a75786da5571fbf0bc6d8d"
-"973995dfb436d864c809e31633d3b7e6019931e06bd9731aa4c2bccd6a424cd78f39d1cd9d2c5a8d7040f20210076b9bd97b2819bd073e1746085e361fdbc9475e66e3e01759"
-"9da645d98ca3e456b440dc5a938ffc2f62e22159c10235a6fed283875b18da3f1408b8177479c5e167dbd76d1a6d072f6a8e7fddd7cb42aa0422129fa7e76d37cfa48f2bfb5d"
-"bc56ae7a022f5ee3855841078531083085002006781880b165948dfd0968652f9298a2dd7f633b9e8b11d09e8bdce1dbb2a63f7775c642fca65abbacd1c80e2959dd363a2d6d"
-"0d18a2c62316208492c7996bdf3f81515037f981098ada39b7bb005db5af5399ed98a02c8e3fbbc18e41ede702d341efdc23f1639ba76398b98a458dcfd9d7ce29d8a48ae1a8"
-"482d0eb664ab509703c3731118605b752a6ed0c681bdde98174ff863e26184f498cd2f1ecf75db7eddc6f1db37444b96384aa0b9e0a06ff348917fc9e78386664c5a49f046f0"
-"ccade33023efb5bd874dabd374f1dbf470e6adbefd3da67ada8cf38b4aa8524cd2aff77161ede6dad6359cc87ca6b8cff2fe68724d58c4f88deebb86f31064d52e2eb3bd6ec6"
-"3c78f1e3a63b704d1bc282f376274240ad54d501ae87a760aa94c90c9264a595b6f448c4e3ae8eab9aece1c5d247e7448ed34b69038ba0d34b5afbf6325b110f50ff3e5f748b"
-"7ea3b2f819a41ea0c2f606f6a41cb70e3e246fc489a082081c71a71c8dcbd69a69a69a92471f7df9249248a28a28a28a582079e5c71c6b5befb1719a170b1c73d269b5b8fbef"
-"bd1befc094b5eb3d3450c7221c7238eef9ae3e090c0add15e56b6bbd75c5be630aa5caeeeeeefae8e1c389b820792f2def794d6e83309fd60cfc0f38e4b02a0f4f02471745da"
-"0f3cf0532e16a4a98a53fd76d6281ebc21607e27cfdd4cf0dbf7591dcebd1ba69eedc209f1180156851d209064c1808d25a710f69b22996534ca52f3eaa011e9b57d72b8ae05"
-"52dc7d0b50ccb6cc0cfcc672b59b9b05028626808378d440926ba6b0371b5fd420b5700b91b2aea832f9c900a587855790eb98fbcc44869c1b786a4a101126f3e45db9d4bac2"
-"cd42a91144c856667eb5d5968d6ddc318cd03b9ac816320d56ae0109dbf59f1cdec08fa775645d69d41e651374fd16c581442bf064c58c55962d4266c818284238d80c86dde6"
-"733683f6d2723274fefbadd60d6401bf7da2c0724010197b588b48a70ebbed75f8cf72f1414a2a4446c8a2b0aa0a333028263ed747a2c92167d5b3a0e3ef58369b7ad0e2bc1e"
-"4340a228f9615f08d034b1e64819a4cc188435bcfdec603094301b242fb8b79da7b3babc213c509c8217ecaa95dbed620f3f449209cf11bd0077261c20d71ce8e2698fed6d53"
-"4ddff5d7a1c0fbf414245ea475730026161b626fcc20cc03443bcc85e4b134501a1fa6fff08ee5c21190e2fff6127ac69834bc4de383f114d84b7f397d7d3f6ee0ae49418754"
-"e4bf89fd591420b8ee249a42b7e0d8ee65d544100d11c5727fd24fa59630e65991182d28ac501f7cc01a233c5ee017e07b851c90b81d146892de60f81d9aee4392c852877003"
-"8d8a5906d92983b77c8f4cad2083305a0cc9d8943af3848290f3120eb96d5290acd41e06f07e889509e2e0a0a60622889299069f3715a016eb755343944d83f4350c39d8a805"
-"70371eb252fb2d00ac9df7b39622e96aed4c2039edac7529943dfddac09fbecc12632d885d964fc99cc5b71eff57c5bbfabdf318961ef61f8794a96481b9542d48d10a8a5f99"
-"00660ab8f1cc82d36587beabc5a22b69407f773bc70668e09a835ba8d15e3227441f449bd16842a76103080302e51b071649ad1920379dd6f40a6b439ecdf2e15a09a097710f"
-"7fd5c6979d2111c035033d220825a06c94b8146eb1f93234d7579f5732ccab5eeb02c03d19eb1159d9f816b2c1ace5a5c2f6335e84220af6cd50564ddb25e4540e9b2d6ec3e4"
-"d8899c0e8442a8d1205189801a848636a4e7ec7193abd998f178fec790714db87b1c33d5cfe83841a239d0f40761a61ca0d67b4ac69e13e1643fde3a4e1dd70bec7443752b05"
-"0986606cbd1cdc914ba17489ec92f97810a0fb9e667a95b682926af6cfe61fe1a36187a9d92870338dbc6560eeeecc26f0d6ba67408c131486b1cd0698a413418a36984c6b59"
-"894731f74dc8cb7c13bd693f834f6f4001b2f9a7b8c5f4e22f57d9fe6d9bdc1f9bdfd9f7f30302f9904025e3f24a5ae3b31699788900aaa222ec5a4219f40ed3cdde804db018"
-"2bc22bdcbdb3c86b29286f602e9a9cf06fc60c8b6c549a864619579ecbcd950e8db21e20b509044814e1cb5486f5997ec3a2a5cdeedfcafe6315b508573b32445190b623004f"
-"96d47e5b0f236acb437c67246971fb9f63e5844d4df03c978ed203e3228a641f25432767597b56d80ecf611ea67dd8ebb9adc057858229436d5e191066ce01bc55f17ec02de1"
-"5ced34004310edb21c104437ac480378b37d31558e0db29bc0921295166e91bfd55055059517f37347541598a9b5400a87d3cb8ad4d098cbea24a5e5219f598563e56f1237fe"
-"af49979b3efc15081363f439c463930342267427d5f529534cdd03261a481c0421d95d24982e275cf7f7c61a57320fe7d0b12b59776977726bb9e86a61cee87846e180d3c522"
-"875d4748699836772dd4be96321e30e01ce06e67a936bc7119dc21a25a79ee05ee843fafb01462168a048c2d743a73ce55a7409eb72ad502186b033e12c069b989b4b25cd603"
-"8bb3dd69e8c1e322eb81067ac7d3f1daf83ad8eb884c033244a9a30a075462cc1849824181384d84b749531301e1d4e0b6153a872efe55c8e18f3eeb99380949cf6d62df9757"
-"9f6f20f47cd990045b4f4af130ca24caa8801f58c1017aa8e13dfff4be99b7e8d94cf3a4b184d5050d3eab05ec8c0d868559061c700999c992e29c148764eebab364edba0910"
-"034e4c0ec43c9afa9fb990b7b7b16398763e87cb4f0f2f0f2766ec705cb3e61b27af5eadfcdf07b8ce5651742f30a7f119ffb1f6dbc841e63821c489c716108a2db6b762434b"
-"1ac4d75adc696fe5fb9f858cb580a20dd6afd57063f79c4efe3ebc88ce62b420f144d1f7a44e67887ec6767550a783f12086fccbae303fb31669f6781e57c5defbe90fbbb861"
-"f459346abd96d30e3686f2852530e677bda7d674cebf71b8b565eb4eb10e13b670a305d2d3060f93e299b34d5acfb637febcac2ddb3c816fdd5b534de192bf93269d99744c7e"
-"7efbc3b5b3d96807a5319facc8dfe33f9a054c8be462a11fec61064074b3e83ddc48372a858e5873b079fc63aa36ebaf7496fa12b45dad14bd01e9292044a4d7a208f4e4469e"
-"0ea34dbea86247b9402f2fea38ca2d01a122070d260445aaedaded2c5462451baa546fa3e5d51622c511062c5500f8e0f1dc87e9f3bfbf82f449089c9f63a09702100591d7eb"
-"8bbf860100b9ececeded3df0f395d2e7e0ce0357d3a07a8f67f5bdbe339b4d1d2eb61d1ac10a2e3535f449cf9022a9094d64f3c9f2ba09d1987239a1501cb3ef38de61c00480"
-"ddb93dde4904df65b4e0fdf21bd0bb4ec752fd5d1e700f2bedb4dc28be093729d2b60baeba52575e746d806c9c8d290e4b42b7ac7f70e15fae2c9a546d48a8c1af209414ca1a"
-"f298b125b082050efd558c81870a688810aa8b8963a81b53ae12d4e2fca207e630e6aeb4edf3708c60492257c0454e5b2a30a34e864b10ae28b053304b332501203a0d504a2d"
-"e9121e85690f7e917ca1c5a489affef683cb59fd9f5938a6d988e87322faa16452ea9b03b74a0545bebb1a0b1881d69954d39908a790b405ce40d98a762f8f2f974b3b42c746"
-"d2ba8c3a6ca661bbf71c3c4fdd558a01a2a345812f986038b30a23c614d79799ca5652570b082184dc2100f121879f187e064dfc9468804449d7a06c9dc7e5e3e85236ac803d"
-"d2ce396b1be3559c984240bb22061d3202e0cb2f9f594190d2399aa253bb9e3c1c68e33da424307be7a419545dc1d898eb4461dee0187359dce9eb0c84c3232b9a4b2a950f0a"
-"788e602b989166dc9bf9b8594b5ad796f153c9cb02df75e6ef8745656b80d9f2bd634292f3d630a065614347573fc2af64b010d936ec4c3b4c1cc3d9d93b5c5ca33fbe4b31e3"
-"cbfc9971528cb3a412a8a33280806cac95ff7232abc20ea8552a1567ff2fc18fc4a5e238f15ff9505c8b36021e86878f96fd5e4b08b1cca303051ce183a1374688b60a560ec6"
-"0ac0fea64a849ac87ab4eef203cf319c50d102121b1e22da1c240339276ca28b0cbe4b70314577c9985083c9a509b9a2e5c1acbb87d6900bef97ae4e318d93240f58f13c0411"
-"62dd158be51dba79344693317776cd85086c733bd2db2948a1720656722d75a1b5d1f16da0ac51430cbc9df648e16b297c0661019b7b9bbce6fe10f036c2a6fb11b7c1a17838"
-"94293428088190b989504faa43e959899806ae9ff67863c7af1794f495d360d711366dc9660ca361a501360ee0c4d760c8813739129d025c65b2e570801ab56556b0010bb66b"
-"2844de4d687d9f9085a051018f83141d919737e895e20a55e1db223a1933202694cbbb48c085b6bb3e72fbf9876c1524b0916633481108a4ef001f47a1a320f248545056659c"
-"e6558599cb1cf33673cdab8fb8b0245f2205e4d1c9e74e4b438d5528ce995a87bfc7ad40329926eab3c9e95e65b3e642e98398500169b54a041964a73e2e0c24d270786fad4d"
-"c2950559a5f50b980e269c7834a0058e1bd0f47cf5d81b33d1b87d96c75d50bba8218784f05f0eb6b1b48b66170211900100c322345325266015336b25992ef264b57e4089d3"
-"217fe7f90e10c37a926006223164680b5525ac0d0dfe801e173e67d37cecec0eb7a632f55c8cc5884100c4afeeccf83edf12500b99030273d3a46822ca1b2a87e4d1d5b296ed"
-"f577721aeba0ce072dd26dee17aa709c0256f1aae22231e87ade7dc71fa6a975411caee7811cb370c2cc1b8bfc2ffa8de3350b3576b7f2350160a683900bd898630589693802"
-"f1969482a8c76e2eaa8d542a38049e75c3bd049c0798a839814395885140c99e9c727b66ddebe54d1e956b9409c88e38ecf4133dab8093335ba4a34c61ba3a84638c116ef986"
-"f50bb566a74f80b26afed17a6b663509cbfb839fc3d7eaa1a4408aaa26ac46692bc00f810b464f06d7f557bb9f1b275c21ed7355a68a1c1989063604ae2da8443545304824b5"
-"a043327d7b1b4559423454764d0271d13350d0df3604515bf1f89ea75368fd722827dbf0796fcf79d2f90d3a5681024402b2ddaf9c50fcad06250337ce469abc3cd7c109105d"
-"d3b676d0d310262a884d45464b264c966622c5217c6e67f2ff2e033d4c2d31d5853fa78d7757c46eb8603b3301c99066558636cb3cbcd33216960d38a05f0dd8bdd2d23a7622"
-"c7f2902347398484f9dfd9976a7bb39becbd3dad46f304f5479597f7e6e8e73e76befc9e62248b0872e90d661642073ad0c58aa2c5093107dcd5e6bd672f9f9fafe7351e06e6"
-"dfe634c6edc8c42d819a024102c06fb67ca6ce25c82a6de31c8b096fd6e9775b8e967bce229cad12f48de9421f9ba3af0f666c648be6622c9e3a758d774f7f7692d65f15d7fc"
-"23a394d0330644d846eb21b33d7a123cb82b7711cabda8a2890d48b49b8a4dfdf374d08d34748ed558477ca4c7862701477d503044e96aaec522e45a89226217c7b8b0ea7ddf"
-"be3c6e7653b7c08c176588bd220d06842476fbb400e823da9043a900f5a09b0a166eafe8c649026644b426e003022e9d2ef2bc3271a2aa6170192cf6a6a5beb84253f8635bd1"
-"b98fa84245cd3d755b03b95e6de3cb19871a09cc77a826d5b7f0d01c60a4346cabf4cc398e16acf0a5ef7f380bf28425db32bae519fc55c6e12fc984dd3fc359c654c6c4ee56"
-"890239d675b52bb06bd258a8c01b814ed5277e7a1449a8a51812f2ab42e2d10d052e9657f170d61448e040ea4b9aa697b1f0788f921635ec6726b2d1e9d5415c870bf479ff8d"
-"e8884a0544b15cf2a2015b80d3ba83ab73a63502728adad6feb52b22eab443a7e1fde3e9e009ab019c772491d2fa287880d53c8d1df477236adb82ca6645f552c06e26897510"
-"a04610bbdc49ed5b5f51ade200f816564377295a76a832444f981280e0f014eecc13cdaf520e67858f6b8856a218cad208a47a40aa928c6af97ca442de6fa9be47c2e074f32d"
-"0bd090dbaeece389964382afc426cd3ba1a76e2c2d57414bf727c3766d436270c57bd3d107827eaa56ceb1191aa9909961c145672f3bb76da2e65f7b26690ec7ec601165eba6"
-"dc6b067f0e9bec88a66fd005925d0f942aa35d0f734964f6086d8c0de18dfd928de7dfd4adb40607ce309666ddbbb1bbe9c2f55efb11aa70cae06f081252e55f710fe4c76121"
-"d7bbca24bd3425e4c68eff2ee79dec14e7475e0fbfd67a9c34a68fa18a61ad5433e9b98aee809d3d3a912cc8c9f32814898631d0502429aee0438a71c2c7a06cd158a09c6bd8"
-"8e89d0bc3386903eb750cf3e329f46cd7c0a5fce58b1c78ce2db7910f39421145d1696dea8d038232efdb8ae4e894806bd642bcf68623520826d5006c081200c34a7949cfd39"
-"52b5aa89967d556702cef2262fb4b9aedb6d96cdb416e8da19983190abb852f69816bae0ab870c83a6ed291879b9f31c4a24120e394c0e519244b8ea28b4e13d51e92bbb78aa"
-"e00e1d166b4e6ff2ea6c302cac118c04053770c1f7886bc546d2cb4752204fc122c2cc334847364377bd3c5c137b5ad939f64cd23432e9af996d7b9b82b568f8385a09ba79dd"
-"8487554c4da422264d563631ccc30299d8872e090c728a14072475434eb154104503a90facd8fd6dc723bba69a96289fcdce815dc117a2d47f7d3dc76d5a399340d5faef7d3a"
-"c292704e6007492e166122ab40864dab4a8bd31106db00a0e2465989a411fba7422241346bca8575e13961f9513c95b8233aa19095b8c6df2c808161766d3058d8e714e7e95f"
-"2580adf3b5d342c175cd7843417d39571ff367512ad5b14b210dbe15923b1d3ba06c931033b6e3eacfb0d6f39b0418c2d499e75b4230744882e23b29e2fb12d64cf1e404472b"
-"f444010299a62ef6b96d22b42f8518eb159aa60289e4b66eb9d3a2997b05958161f5d76b6e791b120050d486b4b12fbc320e0c9fd8d9abd79dfe36ba398d9f25a57f26d5978a"
-"ff8a2d6edbdcde5714b43a5169d6d96173eda4ed1037a1c75652aeaed443486d3380169435a1b1135777b222240a859e5155d803e72839329b42641c8ad4bd5ff6d1de426449"
-"a64816a26eb7664aca85be6ff0d400a002801bb57d9e020aa86b0c248a9175d95bf6eb370f2dbc9b1630c4e5b520b48c1da46b1f769433eabd3b76767a9e54da98d5579331b2"
-"ae251b479bf5c68d1d8a5bb5050d11e9e9865d0776b022f06220c03eb4c14acad0497b1da78a935d17e7fea91284b8e81ffe1938d1c76cf7b855439e73974bd1a8e7b00d3164"
-"480eb8161b4aeb04848b535bebead973fa2f8aa408c1e9fb3f60a0835bd5bc3c074986eba6575a3d9751ca67cda68bba75f263e0cc592b99e7a6e3bf8dfe3814c15b10550110"
-"a92e37bc447c12af949c76f1a69654639a821972cc2080090bc8b04a71a96605c71aea97b082b656bd2e1cdb061d3f14fbad6021b9550501aec2886f985cc52e66f92d467186"
-"4d0def41bfb6c6e6664335666cc109519e668c827083c9aa517c916204211809782c02e0311d55219d958491518c12b40fbc44735e7d1bbffb79b3c6cee068c2db4ce6658564"
-"80268e073f6e570b6ac5f3c5c720499464fe55374e34ef8dd0aeea736b8540dba58208e3a3c7861e9e6d17a793296c7da5daddddf21a4b9a0b049aa4c89b80b051692ba465e3"
-"d6d36ef4ed985f23f84fdfd03dc2a89f101a97ace837ced9b35952bd6d06790d8ac9b6ddf7f6b228c851c34713c4ef7f9cf2661cb7ddf49dafe5f838ceb644720458300740d4"
-"108205a7b4b17d8b76a9aee04ad0f611454de5d8fdcbe0d6d78070ec8f4ea6eb07afc0ad96bc45d856cdde237571ce2324c2b191a905640be53ee7604698b4a3a1eadeba0675"
-"2a4023b14805f0814152a5d8a93217f4caacbc3cb976c29f8029569ed20ea829ff6ee009d9b35b914d32062f4a65c10acb9d06fda2ab3e626ad4e80e826d560f6d0cc4071289"
-"1e96312229c484e83e6aa2b41173412c23d96b969b316342d33d9683e9bbfc1471cc5651dae4d00abc7660d66bb0a2f1e30c6b073635b76b55965987d6e80a0a5b7aee336308"
-"3bf386712bbedfcfc1f5adffa02341504154049ca818d461c4d55043333337032fab96c38afdbe8a236357a8de1a565525e353ed8336f284f5f3efeb65e2a04e52c6b500d213"
-"a5c991c10019db6b5db6c3c7d9c95fb0b0178b0bddf7d7768c1518451e0e60fc203a7948915a3e30516385649c3ca2184a482246fa92c50728a0285b3b3f46108107380f1cfc"
-"e631461b1a212c625238628082551ce7565c365b84837897e71576221de884b0cb2a2af49ae0ce87d30b40a61cb814bfa7c7bbbbbbbbbbbbfdb19fed383c4e270fa1e9f6f9da"
-"408d5a4357b43add6c91d81fa75975fe1a5b62cfa373d9f47412787db55fcbddf92d2303907810e1c38694a5294a53663722dd8771904900080483d2ec514e8510492f38c96c"
-"795455aab02ddc6a90a79c9c54d13cb9c0a4a8c4acc17e32fc4d7b2afa9c5c6d4488f4f8c1bcc5568b45690a25c0dd1dbf7165ea51388344cf1e8fa5796bd7d3db762fe95e8b"
-"b1841d8545e9c764fd2706e509328c484961a3a3a351c748b8463fc6b446c65f5638ec66a4645ff3155adde7f14de392dfb7dd7076fa5acc1e9e7b4d83818b7dc1d54f526024"
-"f0b8984c9e370f88c6fe18b9bc575f239fa4cf497f7c4a6c5f625a4f3931d0aee1eab3580ff0e1ef715e35b4b8e6e2b6193b500bcb352f460a4003aa19ccf08d5ac9bafd8ee6"
-"0439fc5f615db9e88f3cd5ebd94224a695cdaf6b33d1fe25de6cd3fbeeafb4ecd4cb9c764f6bb33474bcb6459302161af9bd0cce797a9daede74bbc58454ceb54e1353d764e7"
-"2bb72e614c3dac1a5dc10bb60414862c58ee96aec3b269b91708160484354effd31bdfe6d928353a64cdd810c35bcf71bec7b3e8873811e862772650f9c269e02efaa00d3803"
-"e5972b0e048cd2940e150712913a920c922097f4697057aebd73423337f7bf6ed473f83822f0ac7e44d7cb6cc3b9998afae8636dff4b96b373a5a616b099369a9eca7c4425fe"
-"69d88363341fd24c8a1c7eafd512b8363c589d30eee2c5e3c986f0f1953fb985afc230071202efff2f25c436023d4876729b3286f3100bd5125235bdd77ba4bb0d421a7a930c"
-"d274ccf98db714b675f8badba1b8c39fe071181b8f775e2cf69b9c79e828d1a56c5bc1cd4f710b67a613506c7e8bff3dd35f93c6fa399462f9f120c15419023451d434abef39"
-"6aaf5755dec4eaf51351f021a67b0c580c9adae7f9a3622c99986d5bb6ac22040150dc308e7f673fb5e34d6d1751f732691e3ad72174203e4ade8ee21d12125e8df7da0363d7"
-"27488d09ed8ee762eb6aa3470108417182500c99ceaedd69a1dbfb08f02f732ea537bcbbeed4cf7033966bf4f37fe697bd60d9d5cb500248161bfbb4be57ae5cc33912e62ac4"
-"b96971ee9cbe56ad319ee916536f9be36c9f3dea74f9de85fd3f29bfe2e9cd170d6aac35ed8dbe311e4ba9b477b62f841f1dc611c280a0a0e7380f972d614b33aee69d8714d0"
-"989cde6f89b6f9f0a9a05f2e7b24c10fde6055268c125154ba29710e23173124cf49d05230680e924e0f04c5e99333201c180af98a22929802c0d3830d2c0cbcf5d93f1f3b81"
-"767737c2e1746ea75bc6ef35bf8b1d69f194c457a861c46068e1f7f62715142f1277acd835abd9413b34347514710084104090811a0ee73c93ec0b05542a46f2a99d48a0aab4"
-"6acd84232260554904a61caaa594d75124128e972df537fe7edb4b1633c5bfe45b6d799fb1d77bb21edeaf6bb5a2144c102814e8388802b502397a464809fc5ae494533a0065"
-"01b021cd38cd86ee2c24c19152a4a1547b0e429bdde6f77bb5dc6d90bdabdca6c5a8bd6d3223a7ba6c58f20814d84bbd156b5e150d643eaa19af6fb0a0ca39418557399cef17"
-"36ea4292c96b288b26983e4e16d6994add8c6e4a693b339994f0415ac083e2232dd0916445cc662d420b94649371842748186ca9bc16e66f57029126f14730de0599ee2c8a49"
-"183c480862c4316828259f63085ebcbfcc531ec8936a1343340a276c2ff08f9d9ad8d8fd6f0f345e63bee74bd8d3fa1dfc7dccbf9d90a4163c213760285ccf66921c74017e74"
-"15c3c3c36e8b591860b6df3df9f17bde830e85e1a6bc2ec72d0b55d2c0a4b320a72fec744e2daebf1548a530e70e88c9d65de07065498f3e80a1c8859dadafb07758fe261919"
-"929904120c18066641273c36cf5043a9a876df10515df01a963066446eefe894a389471ced80930d70b868a4e0ba4d104c24eda3b5da6d33456641b6b6ee85c4ea2fae4cd76a"
-"5752d356d6d66027726621013700d2babc6f6dbe1eb7682a0d9f16b785e18701df58d04119c9642080204e6839444a2206749481841e6f8f925a643960880af90835042152dd"
-"4fa3f81ebd61b061e0b6774fe2fbbec327b51432338cc8827c3428f147452c6abaff0ff4e2bcc0427b8a41c3ced740df5fc17ca13721171a89ce62335751c87fc0bf9cd43290"
-"c7954c5d655510db3e71388a515184a840066608dc208aa62dbdb256f21caf23ceda7bdd3a09b0c5395de98af8fbdacec01416679ba8d98c4c0e77c733b11698f0dcb5aa294b"
-"8d807943151825ad1228566c84576d396727bb87e26cecece905f15109530b2f7aff9d4756dfdf261c44724dd65ad6549bcc2309af5b1bb5918865a2767c9f84a38ad6303e48"
-"b4edb13cd6195c05a9c1031830a0207543248baf0b956a5b9326f645cc90900fcb4d1941d286212f909046a1add7509250755992b95692706dbe8fdb8f2a829229dd2e0b0658"
-"aced370bd8f02e5b6d357abf33beff18c7f37ad5f455eb1dc69ba1d0dc9138585c534025d81912ea7fa7ea478e2b869e0d2d257a71b1f9d5137d0153c8ed29294510c54714c1"
-"d5bbb1971082dc95f76946a45b5fe379e21b7b4124a7631772b7c9f270da5c407cd1e22d5e77ad65455e38f1a0053b9e4d3675fb88ad0c2aa78c8e10adfcee8880b55543d02a"
-"7c4acaca386fd4d94aa2b98e93e54818504672e3515b5f3308859546a1be683f1e9dbf5d49682b1b60654588b0f1f71131476572030a0f4751b8f8cc67f0bc9d5736f66e7ba7"
-"abeb4e6e22081a8a04818c085052814651113cc6c9e6e887c4a2b4bbf879782233ceebe11bf370841caaa1af82220ae4e123a049af86e4da36d42f7e487e715c831dfe128e2d"
-"d69dc5c57cedc72b3107175bc45bc1f079fc97934c6ff8bb0e2d02149f01cc8d3ed15b932d933ee754e208915cd5b63d372a12e21ae240628834c17307e8abc03658deb33286"
-"bdfd5ecb6b427a8e2bbeff6b51d6392323bd2d0dd7b34e91e3251fa6d0c1b1f3e3fa6d209ff70c1a069f6efaf8d8a842e2de1ac93b4f858a4a020469cfcdeed338494281222a"
-"367884395881ae9c584a2181c7f46baff7bfc0783345bdec582a358775b8997c0a1d379da3cff5388172d651f79c5d68cc91e63058923939ff4c984010a9e1202ed0538f0165"
-"315083f77e5601121555552517131b5e8ab56367c318fe414b8fd45e050c9318c3632ffffb1296c8a2828b52f3a8d341305bfa7d5e5e5ec98dd9334295312360dc5fd3bcd168"
-"8344387f49c979e1c4ced3b86710ef55164f92b1b628d24844373560d4a90486e290cee5bdd179965604af99ca3184b1826b645aa41008d3747633ef291214abf1e26dbd356f"
-"e7ce4a4fc2727d380847e3f8381d146e8770a5f58510385d1774a415ad4b7ab7f5fe9b7f0cdcb207c7db5b2dc7760d3c67a4b27bd91f6ff0ec799d08f09eba7f9ab7ee26e944"
-"b404ff0fff71b911c17e5fb3ccbbe316ad2a5cc8ecb86ad0a4c210188c1783d39ff22ea21f9a06b951c4070e2f85d2bf53de7d0f594989d76eec1fe2202080e4043bae127260"
-"b1042e110e708abf271f7b00f817b5f7de6eb05a08586528d6e4b91089d52763cec7c700a85ba9f1117881047cd777050926080f2941fb31e0300ed05ca7709c825157a5aa60"
-"c6c329182d0d03ab547c8baaa9b58ff0d5162d182de9244c8a01197c8781d07b74c1fd734ded094764e1ff1c98448f5ffcc1df6e5163c17a4752449caf7281757e0a2085d396"
-"5c3120edda11197c7b87087c9703b6bfa9279aa0972c79db10b059ea850741ea14fa326cf05e3a4eb1c6d8f3e821575011f1223284014c563a63097350e75a2f3636ec066817"
-"28502d4a4004d966a636cc1f9bb7eaea7a35a405b7f58045e981dd0a5715ced79b7001bfcb7e875e33a5a777a6e25fc766e6ccc2fe37e0e0af96dded7bdb7141d9b41ea46b9b"
-"2f7a7877fbdf1368e9e3f7043bd40429a232487cb459b8a7fd76dfa7b1bdb08b9492ec453c78ca198e13876f0cea69176643dd9041e8b83e2400347a199138d849ab126b5967"
-"4afb29aa6718a62d871560df22c8d25402895204d25c69fbd74333928952e41d6e3b3d8efbc885e262322c3cda50cd1531731c8e4f6db7fb59fc7fd9cb6ec32d999060793cc6"
-"187bb15c0a7893249aae9dd47f71c1b81794a24125c99a1d5839782d80125decf4a140d1640dd9dcae5058302903ab4c5ca8b0f4f61ba393ec6bf591057da1d6945e319f67a2"
-"c1a902b235edb7b82d1aa6843a8c3deba2fc5f95deba728ff57a665cd6cf34d6430cd6039d09a5c838d2a422529c149a88a00083cc347c3c54ae4a2ff04950588dc572124ff1"
-"620c4de58682bb14c0ab1c5e8b2dd87baf98efc83f280ff082e9219824273e899402105403e69a4453007e08bc8bc4bb159fe304a1fe44265478dfadfbda921a8a226ea06149"
-"ac233d92ed47ad3bcb9d42bfe3dbc9f44c4ba0b9d5ccdb9776ff4a6881f4e73158a6bac58f03339dfd670e957929a81aad74da500406fbdaef7b4c28b024a2af2fd47e2e677d"
-"e01d06af7be5adf03adc471535b73d4fa5f3da79f7c88d69545146292b7e6f7446a1bea88750842fd3b9978cf058535e3205f80d8076db2154cb9441ec74fc61d099b81563bb"
-"8f960b2abf038df92e02c6b371c4360752dae3973c0a23c931fd5b5b49aa85c104008358c2b4534f3d5567e45e169165f4509cf7acbaeabae1c1fedabe221936d20f0d002671"
-"8f3186534c558eb4e90934804fb97f6db8d10fa398cc45d65a79ff3c14b5c2b46a94a622a4a4112b76ec6e3cf789d27b4e47b9fb19d95df3f4737d7df68efabdef0c52d57ebf"
-"fad82b806f68b8a58f2df8839011dd9196f3194c600a09420d076d2ac81702552114c42097ec1705eace9a0401569358d369c990693a48206a903ae7073e62e1398a03df9612"
-"b656c3410ea0916d2530889a07cacdac09de140ed41024f3211912d2440200fc59b8f9d709e64cd65a7367e28f9fa7715900f7b8733af87b3e6528ddedf55a1d0e80db96e659"
-"f266db8c88150e59efa0e7ea7adfc1c5d0f71c7e38dee51d14004924329d1000d8c27b8a7c8d271ddd245f4cb5a73558ecce96d64b053414ca1245853450955460d59d3d8603"
-"a825c440284de1c4a4fdecc44e60a51099125a4448404614d4a71325c872aa8ca0bc87589947469f222cf03becff1abbac9d56bfc9bfe6d37d9fc2ffef3b1e2b40e163b87d42"
-"6882ef0466a41c4488973f0ef19a428f545542ca07c9ebebc7fa157efeaf61f7799bf7cefd1c7f375db9adf456912144292894d6b8372ed140710d6dd1d9a8115f9eb61e62fe"
-"ad8d87e9ea24bf0f72da9c78c9fb0b142a51f2121493229400e81ca2ac31dc260f62012ed3a5d595a20dbc01aeb8bea6046628835c606b1eeef9c13cba9cb6b9defb3d44ce17"
-"5c6624eb7068f5bc1d66392282a867e33f3c5b73566099c611bb9344bcf8793d58d3b4e9a0ff9da1da437f3d273baff5a1fba593e4a0598120127cc4986a819af11fd20eebc6"
-"0ffa9f538be0cff641a0f46009cf6ef8ca1f7b430926035986cd4ea07332d1f4e75dd36100cfb06a92bb0327154f5d59612b2a85e90c85c990241624990cb4fa9f5dbaf87e77"
-"45c7437e7799b376604c44302f0c646adf56f8d91bdd24e5535e9f3adace8753addebc150ee7637e9e18a1b87521819ad00520a108385b29dcdffc44f6b6a5fd81cd21185853"
-"8ff0e859dc89efd6392fbe8ad9d9b21cccbae4909f3020f2d9a1245f3990f5bbea8a77dc1a5796758f9a018daa770fd1560790fb1fc8a56748a2b04fd8e6d1738d45a957bfba"
-"384225049b218ce288d6ec42bdcca91a3e2eb8377ff5e96de634eeb8bddcf9d9fe09f82e36d4f3d54574cdc51f6b0e661e1c03363ece8be7e559f5f6b6e07dd3212816213b94"
-"1f718083f8294eedbcbf12e74dfcf94292c77ae9af5b63ac79d66e0418dd3a0d2bfafe0ef8ba70ab247e3dd674710fd095a0801a0506924720c813f327a6baa1040e41920c19"
-"1571f77b65c8b9fbaeaa9ac72340cc62e26c2fa0b24c0196dc9c7cc25c1eaf3908da2855ac11af016c6a780c8f4ba1b0d4d9b846e8e2d168d2608a228a99f6a72c89c95940a0"
-"b03bc8dbd5f20fb5c857e781e958c85776d5a631c245a64642b92edcde01312f9cb0aec69509d14981b9d1bc7190c1142d4c68f2d0523e80f9b49412ce9d06e0796207d1cdbc"
-"87554e552218669166f5b00cb51bbb5510036ad8edf63f45b713e5407f3431b3d547c559055736b6c9fe56f5b7f6e972326251abc98404062828624392de0c1004186bada7ea"
-"ba373d84c2ccea65e8c7f545ba8eb90d3f73fa828f67c9629fbd609925447881b8ea871d73c65b3501449bad224080662a046c064c9616f3a862c79037484de8e98565f35384"
-"8994a3b4e25080b2df2f85dc1a384754b4b63467cd14dee5eb3cca879cefc5dfb880040e799790f1589d04507962c4697f08a1660a1ea25155ea581b9dbf4b0b44df46fb6c22"
-"c98d63270db5de7ee2a5accf5eeae341dfe9fa10f4e349ecc621c5f990b13329532f42a44a05727a085ea9de5a47b2d26dbf717935c0bca8e18def3f11dc2d3507374e89cba0"
-"2ba9f2dcede0d453e3853de1dfb4e4983ce1ed03dbbedc4e7b3927a34043f6c1e1e1805dc06f4a7971e62ffa1b615e35a2f325cdcdb5560a29499e324dcfebf9ef2696972124"
-"f6f7ad6caee195d4e429a85af70d37d0e6e194c38d939efd894b302102ed048c0c312f52142b3cc48846731142b90700c88481867a3af5ea0a01c43f20584870bce4269c1f50"
-"c56da10ed07b1e76cb217771b8e3423bbde0ce5bec39ea181f0328191b03cac6bc17b7dcebe3e77e0dc0b9fc2e220dec81e1a8407f7990a2e223b637e774808a68080ed94757"
-"480765394dbb7560de6f8697950f91866a3ad95e432cd90ac887e63236bbf8f876b2107a1a4c08988005109a92136c86d85b5606d81c735e4360f07318b32f83e5ae03c4baf2"
-"5b40aa21492a8d085833cdcd497c344aa2ae2d25a1793447137a1ce15c29d1b0ca6a9710bb644f3bc3bdc3d3f65a9b9356716310102776eed97593779be91065060741a9dbf1"
-"3e84340ebe7391c2881296bdd42168612116d3636682316c16a84f2d8806b95484722abdf0d0db6c79126dd7e4f2b3fbbfcb261164405cbf39d2ea4488ee15ac3dae0f26cf4a"
-"de4a3eb13b162484e9d048b90802c08066646658ce6ac68702db44d83d4bdee716f6dbcd6c8a7ec6bd5a0b3182fa67518093090ab3944d1b81ca5928cb5606b53fd3e5d05846"
-"8063ba0d2eece41e161f69bf2da61b0b0b238476fa03183ed0e78cd19a996694420998e842ea1d182841dced383e0f7fcde3f4a9e1487c2a041327d32241f474502312331735"
-"93e06ef36397a2b26e1175590383ad65d97588b01e998bc47d4084e765186a9e65e5e2f61efe36505b35cd718e81253621f36b08c6fa79098a33dbe4ac3077fd1e528fe38f71"
-"be77a59c6bc5cabeb4679fc535c5368a5289ab2ad752bdb1f0c08500c0e3c1e1b5eb9a783d2a0911a11c18f0a7fcdb3c5cd937c791a8a4d6c415cf14db69b6f1aef918eeb217"
-"e0fb1873c44a98b871085e9cfe12c3c15677fb5d5c0abe75506932fe577027efbc27192ffc7ac5333efca3f83ec80ce0e19d61a93d3a528955024fa2a3f790ec391347425515"
-"43e1487e0444c67f18e1ee3638ab5d5680d0e2c34293e839966e8c7bea56d7ee687e64c9b3b1478a98873c46f255b725e5c452c8b8a9cd5f7d7bdffd99668abc3bbbbabb10a0"
-"1aa81ab8a7183da5448751d5903dc8092119d5df2d5311536b2b59553facde4c33476058797c46698006624258e0b55f4486527233a130e5002d05d88a10f37137a0ef510427"
-"c0b01116e2e7870fb725215e0f8dc4b58081ee2c3ec46ee66ca5f135b37bb9222224586baac1c0653416ef90d3f7f6204ce6d4c18880a9cb5ee9a4665010cb4a1000942f6fae"
-"77afdf2b6090163e87825c6275b729ebf12784e90166cbbd5a782bea271152f59fced54164933915600909cb5404bf7c4ec170df554c7eb3ca307bc24d7f47e1d8137a9b0ee0"
-"167d78e32aad62c5adf65d0bb7ead9ad9afbb9b67e7dc75b7713e26c5fb0499de9bca7c3d8e9018a0a818b1021daf1e1d7fdbf42ef13b6e2fe455c748b9b5932f2f445d053f7"
-"1e162df78d5b72a82d807a25568099f7c86af4029ea9a9088a980f11f1e0858b2ef8c0e1ae201638593ce4f1f7b8eaf625caa1440d7257e40f1de65ee65cb905d6a86ea48c99"
-"c5787bb2f50494204451458b31427fbbd6a7c2f3100444fb3883f3415b6815402fe9eb20691d6c916f211eb3a2f3bfe971ff2b6eabab8f82fadf570e0968c1e42cf991306441"
-"702da46f429a5084190ab329be5a16250640a7cd1635d7a0a2173f455406b2cd9fc5b3d23922e7181f5dc4ab977dd3aca8d878760deaefa81cc9d24311c8886e6f6314422216"
-"78569c551ce0477f6f1f13139dd85d35f49ee288b021c561db9e058448911e44833cd046760829ae7208922051ca5cc95d67bcc18fc1f86cad911fe37c594948049ce8d6fc07"
-"ee5f9e452160c5a3945f2bd1488c6ad487d8a58fbe77ee646ce55d877aaa5ac166d9c8bf6d8a906ef0ebe8eb405a65274d2d6774b25939b067075922457596863bbfcff9a7d4"
-"2997e7cc14788a6cfc3a091843ac0c0226864443a7e9f51c6ed79ff1f9bf07bfe2da67e7fa98731d3948d5508d2d14a80e77f072b6b60cc74b232e47b3afd64bfb5894ce7fe4"
-"1393ca0be1b701d2e75c266a5eb6c24741545c7c28134009e9de2746debe58204b319b05936b018223030cb98c86b9f201074510117a3c6ecbb579e0546d189ad4c58b3153b8"
-"15531a35c033249807b1080485500b3f7194da83659b65c1d4dcca454f9589ea7672350f00164c27a96f9f789110dcde084f5b3dbf21a1566721bf68e5129a54a4210a53a229"
-"6ca3938da1481a8a239805b0298081f4d37942c5432a3e5c872343663d9f37a5eddff5cf5b02d86d15894d82fd822707e479f389c1bfa1221b6db45b3df7ac266bbb59af339b"
-"c5fa7959b1e8cc02123928eb088d286a71dbd548f4def7f42c28e730d905634693041615e525d98e63c9c1ca56bdbb578ee65fda52120421ad49ad544e9e6b4bd57573bec71e"
-"04ec732200581c8f7908c8dd77d6aae1abba22f06a6e481110c032042dbb9e37eb0d02a428ac9be932f24f489c75e3a4798b05ecc1819ddf616f277f70cb96363a10211ed92d"
-"8077d62cb85d51b904490b300cd495c9b89b4c41f0347395b1bc0273f3feaa61c416def56524645113a2360c4e9a9ed29b04a80c2c605e2314c2caa8ce276d37ab1aaeee0d1c"
-"ade5b7672e0fc6bfb8ef6e9f43078a25a755e1b9d27fe71f813104e03a1b2da093729cf6c780bfa98bd73b8c4443dbf9f3adf862aa21459948fe40184240ae419a8644153093"
-"1593caa845c821ceed6af4957759161e170b783e2710f6569d93e6888dddace47adb651d9afe81b6ffbe46a0734a400376465eec43c0d7140c444e03682465124c5a39be8e73"
-"38482ac46de6dff8964b7da6c21203f5bdd30089f9200d9453e084d0a414c54f8c651afecd3217ed5c0437ee7bcdb6f36bc6791c2ce69c6d880b77a2b8e9f2e66ce98e8d577a"
-"2910c186b77d5f8f08867cf01780f3ebc28a675df67adc2e8f1da4ed2d1e0456daabee629fdaf2dde0ecf56e39e6e173108286004559438fb5a0084a843b6f6f0ce050f00d4f"
-"12f6be7c8fd9abb8d43606c5aeae8437784ac2649422f4d9d61b15742b400441064c8c0806218a6475f9fa505a567ceac6f3745a945d46a2336e404de97b2aa7af8c97220444"
-"83d780d99280812a80d72ac2633a4bcf5fc8d1f5df189165d1a66567fb6c2e912c73e35e97f6e88e748155104680666d87cce759af1b17639abeb03f59c2904387b2b5192283"
-"78d9cc79f7944bb5a2bba4bbb6a8a78255be80d9ce022ad04f01104186e304041c80026e4795f5acc0c8af12dc0c4b7009d6040f7e6fa573d4a1cb67ede9edb13b0aeae7163a"
-"196dbfcbd845891112e835d32b74a264b3082a483f912cc668a6f7a4c3b1c9f13f11609c60c35915be3baee76146d0c84afd16dec487e8935df336ed5290c310c43d1b44cb98"
-"61a319c6e9ae41d9e272c9e1bf9e8886fa9e61507b214e4d0e7e95e33582ddf0aee9f5f13c3407362af9bcf2b26e58b397135094716dcc08248a40421c5df976acc0c1631165"
-"0bb4e95248dcd0fe59dead59b2223d9e54dfafdd6b5ac70ec1bcf41d17870edee367799045896ed79049c7cdb8c5f849c7b1f944303e4f993cefa6cbe87925ad902ad6158ac8"
-"9014063836b443345400f1096c11eb83eb9ba68b8f05736c22de8463b0aeac3e84fd99c04a43e03547bf140048620214161a58d0229100f6226b0c2fe526acc2a1d45a932b0b"
-"925cdaf971eb99752d543ebc322b241bf13161dc3e085a57e67924977509120dc5afc6bdf1e5b97243b081c80e294014a5204dec27355ed78d5c3cb509b253c74b2ec55935ae"
-"bfec1a37c3618188c8dc27332d291a5135aea773bbf1e032d36759c515415463d0a785fe6da6c8057d0b09fa89c0402ebd8775d699b5a6ba68e4c9268e4e43db5304a8da07f6"
-"72e0927a06a30c4499b54fea1db36c83fb79efbe00078f28c8966cdc15bd50034ca889b35e98bed602481110e860a96f85dcdb4ee0c824c75e226402def2e02044411376b46d"
-"2db1a11881359d574937ff4a88887c997cb7f9e27a9f64bbb3447a8221cae89955095fe4e75dfb196843f3733fc7539cec7c5397dc6f9acb50aa828a2a97466ade77c5d25ac9"
-"cb1e5c219ff2ae13aeee2c8b2e25be89db55434ca83d52fc504fe0a4dd155153029080a80d29667326180820e9cee05eb835ff4b14d7abe329dc8745aea4687a5e85b73315e3"
-"fb9a4225fe9b5f894f82e2172a28baca17fddbf2984dc75a7130f7208eb9b1f80fcbcde079fdb70aff18363da81c656f35f7a3ca37e120b3bc917b3c3b7ebf6d91b6d7f45537"
-"a5ca1840f0392638840e53fb8cc9ccd4a327883701d252336b291b0cb5bc9950590f37ca7b675947e760132851aa96eefbca8c0bd1406a05b24c6f373019d911a2979b246ec8"
-"6f3c3f7770789809c7c74b4de41b32aba5733a82e698d7c39f502db92defd13ad730d2db606fc151010c169480a81111c233cf56e42c212d91254da0bc039be239b08a95d473"
-"a98ef62069f67b0a6c67518240c60ba1d618845c51077964dc0d3719e6a6468690acdbe0c76d868fa60b4265fb70b48416241e7f828d521f90ec8d737bbd672c4d8fc69b3307"
-"cda1c5a68fd97eb8ee5e1c0ef6ab018deb413f43795b69db43b94e297d467b08149772881c82b434f5d35f87c3473d86af4b71fe39ebf6bd8a0c05bf17dbf9b7a9cb17cbff61"
-"1536902f3f5bc053775485b00c2f8280930466666732cf4c3c35fb8cb17f399399d25eed97fe27f36175fd2ebd8f1ce8da225a8215d088276a046a3b34af48541c3e75e786e4"
-"98771d4db6e93c90d9f16366c298299dae63855aaf74e3da3ba3c3e9312fe43ede3d2dbc670729c6a15f4cc671ec019d0ba3eae9739f8c4e46ba55e2a24632d34426031be5ea"
-"ff2f26cd865f08d453c1c42b49f29d13d967f8dc2ff671a35d9cedbcdccc96d06787f1b984cd337e1cc407b7dcbe4261a224febd8c45bdf60912bbb18bc331b3a3887431e4fd"
-"8f9769e12c0b0703ed8b122d0c20865741c48e51ae4066e559b0be8cff24e3f1cc08df2e8213aa7cf1350edfb56bcdbb30c1697239b4f2c47bec8e55d9f7d128d3fd4be1b863"
-"437e7562a084dc443f408f747ce975c667a5f3fbde4e04bf27ab7f0b386f7acc0d22d0bcd4e3a5a24ad4d2e76357ee7f8ffc6bf8a04926d9bbbc069b2a07bf4cfd5607cfa919"
-"d9b353460c60234e2eabc7d229bedf1de08fe30fa1e28b8d950db37215223414df129090aec7bd13e911e3f8fdcec5c1b41aff331c3d08cf88f67787a77b5158665b541d9efa"
-"9855740342cffac766cf6597ed26e787b7fedf4620695dbf93a8741adee04711550673290a6300b4e200426de8a3873f3dba1ad170616dcfb7eacaee4057329f334791a1cf6e"
-"1d9b40c1796bf6ffcf2d6b160b3e91100802295d6896f816d5a1a04faff1a7ab3165d77a3b67a0d00c6d072ee32f5dfea9c7d94977f6d64badbadfe799a48cc155e4bba4a096"
-"911d062f325ea92d1f8ce230d8daddc3faa62d8f0603be7866eb06300e497fb70c4766476295360f7d03f248ffb537c4b96a15714763c356f8ec2a2c715c59c1874384d0c406"
-"eee7f294d670a472f5d8e16e13dfc6b050fa9da711492dcc77bd334d6f0c138e03586c6ccba4392aac54e8211b072530538162d2657dfc04b9dd77559a359326f5aa7dccb30e"
-"5b22d13cdd2889e85141b6843ebda2f14fbd8754dfaa19d9c294b0f6d5f895fcff9bbe9c754350754a03e71aa0da784ac056d393e267e20ec036700b299286d6b74925352556"
-"477580eaa67304087f981dd53ef8debd46c1624f52e8b4da7f822a683def807d33de047cabc3e5cd9ce2b01ec246ac3830205683e20786b290973a43508754873b36b1d53f4f"
-"cef51dc7ea5e691e7ebb2fb5e174fcdfdaf6b8b69351d54edea84640b3154c9d2191ce56455399fb384fd92fdfdf76fe299febe1f697d50b2e97fb6ca0ef14a4526a4e396b8f"
-"0ee8040856e2b559c3468ebae8fdfa59d7074fa4489665cbf1e716ae0bb8660210a7359b025fc8a21c140c25ed1eb5af3d207e624f82c7b4cde0203076be60dbeb5f1978da07"
-"b620faeac5e1a0b286e5e92f2e3bba379bbdcf97a8dd0ccccedbd514de2b4bfaf528ca70d068401fbfbf0816465ea182258c871cd02ad7d19c215c4a871d18f684f7ecbf1a11"
-"12c91c961450ae42ce66fb6d97489c2e5d4da43e44a443e86043062f7b6ab4c887fda5bf12d0f0d28e578de874bedf1e33a1ac4f67435c978842100a2a02c35ae76e7b121f06"
-"47aae4945fb6e112c408a949814bda2ab293d25c9a5d11dcf5464a404e119bf99c938733d757e03c6d6f06d002b82ff35ce1f810bd6e940f499b380aa4148087987a3e679c42"
-"8294257a97c9c3ddbdcd9c261ec16b0a466707f6eeb85d07af793f275554ab737d2d03a2a3d725f671b155b31fe36cbda58ad7cd3a9538ba9cf98fb7da7a1568ae0dfb5834f4"
-"af14478c0839511ebbe5420f47a0968ed95ec7e90fff99eb8dbc5b89c4c4472288271586147a1f08c70d53197ac7fb799b023e0c16be777383ed7db908f861fbf3c955a1ab7a"
-"f27c347e9105012bf20b381b0ee34e970598c57d5025d96b99609d9f0e2199ab4512442f786a4a50262276b53a4c47079dcb6e5a32c37d999448cffb8cfe348ecbd06a218808"
-"5293e6a5b75d1a89fa746db846f6a66668e7251ba6fbb74ef3aaf2e61763af2d0cca76088d57e5a646ee8a4d1ebb4279cca3c77c03f07944e1bd0e690f1d2fd047d408f6223c"
-"142327b56ca9e551fd747b9e8dc7f1c31855374eff3d5eb43937ee9d4623d9d4e329e89433b48297ac1c054f81136398d9d49f3a9b50881fd0f0b0796665a7ffb34251569bbd"
-"122b5a32e18e00a0e21600cfa718a0bfe7dce7cccceed6163e3db54a2deb964bd9636be9ea3d074260f36b578df193167cba30ff6bceea5f9dc656751f0d8f142f07ecda685b"
-"a4a5bb5098febe4e9940dd28d67d55f1605bc8d797c58382f6e060816d7de92dbe3ceb0e1a0a7afb852b3b8d9b49a7f9d9466d3f426b4906d022c7e6c64c39ff56d3ce8f2a47"
-"3b96fdc4bccf4130c289ad3833e9e73245f4993177396d978970ebb05a71322ab3888f21c59dd6b9f52299bfa25f86f3aa8dabf184edcb6f5cffd64a455c776d7653e0af8894"
-"07b2b6f3b46d726ea238136565158217c43c9b04f8a5fe5ae8fead3eeece4cfd1d654a8a531754a03eb84e6edb57d345ea6f4e5d6e3257afc149a3a7323332fe74e6241bc175"
-"deb7fabfc79bb7fc7bcc512edc43262373d94cbcabf19170588f94f9d6b0120838649e11a22fee011f2b6573e9b578e675e8d2e87e1ddc43d30b96f181635c422fbfb5305480"
-"4c88c011e4a4447c8b8298b36c577d6d96c0fa8237747fd76af3316906089f18028f8482feae90a99631821d8a71363d1e2d141fe971f874b1cde7a5e98e4096e49d87a7f625"
-"0238200e71c85946ba0bfb7555ef218cea5a853d9d7cec042828095c89b650e56df7b06779a8b27a3d9c9f586b63e35089006ee1a5d41d0640bd918b2461e36c440cb91c888f"
-"e4f862f6a299f49733bb9ca8bce252f8e311016c1d4aae4135aa13a8f754683534e141d81c2749ee9200dc5d1247ccfc216280683a2030f8487404a075f41da76a1e76b37e0b"
-"00dbcefb941a0e3c8a66a4a2a3b5d479a04b4e861baea4ad168b0320f89d859accc1270d615a85363688c897c695e691c5a867ddc020374d5c562c38de09b820288aac582c05"
-"28b9602322208c88c0c9581b8c76be4448b0fb482042404a2314d4b6816702e0822d5dc746df9fd313e58ae4ec87cff6fc3b01f7993c0434981d3a05be8d1f6f29f3740a828e"
-"8557c0aad3ee283e973545ccbfd4514aa2aa64bad68c51aaa5451f554dc9af60b906fa94887cda0a88f66d5ce1762b7f0b83cffb6d43ae678cc0d2d7eef71bfd112d7f5c826e"
-"31104835a3b6844bf920079cf63004100ec8024141ed7f4eb203838e63340e78817060120ce2b53154e8d85b1f6d69ee184b0cf1ba0ae8d84d21d1bbb8def9cd0e819e4bfd94"
-"679e11f92769980fae30f287ee70ea4cedaff1813f5c9025dacb692d00fa0cf3e7effe1063353267b98b6b625021188296f4ade41e5dac72dfac9224758a83dca71e64f7c100"
-"f92c7e071dfbc79a396c813ac962a354d5da2df86770d9950528cbefae6e769b0bb38944c3e37c72afa8e3c52497560960253b95b01c252821eac461e26dd44a535e30a3a404"
-"f468f13caf9761dd65d75fdd807c4fed69ece4254c8d18313b89178324169066a3144e77104acf289bf9125652dbcff579f1211f06fff87af7963f57a595dfbf0f2faea74541"
-"93f1081c266a9fa1ba0442c088413f37c9ace330fe53ceec7a2e417ce63fa737dc7aa6b0cbe53083e1e9e64c6e8c87601fe54a438700174dda37ebadf956702055fa1deeb387"
-"86e2ac7630890d156e4608f56965669067009f02903dde1a2ae323f16f3a74fc2cceac67f53e876966a4ed64866c0775708ab9ac4976b54b94114000a1800c97cf8dd53ea8f4"
-"5a39dd9fbaf59e47c2c3d86c6eb593d0de73aac4631920282c82c8b118312451f7941eb5b6d57a981da5c7a4ddfe86e33be177fe2f9ebf38f44a88124915829dbbd9c3d00bb1"
-"fec7746ee2ebef788ef28d2e6e349a93720e8b018672d7c29d0fadd24037978ed24abecd6d9debdcc69e13da878b01e82a174aaa241caf9b9c5bedf97bd9f03855c1f6223428"
-"c7e688441a50b460bca3eadd6fb4beff81a5f6bb4f63fa50dd181310984c37eca6c0629968c653b5079047f0eb6e460e62fb34e01580deec430c32c302a06199efd358d7dbe8"
-"2630e9fa1fddc511eb797769d9be5daf01deb51af7869320d478383115a612ccde286aa149d3b7f1d0c0475e2ceedb378825ebc648ae1ba5eb9a58243ce7b69daa0412080eaf"
-"89384fa54ab81703d19e1136539e8678f5ca42e502ee53b8ed1969eea7aa7278902651bd4ea3f36d0ac808881fc928440c523bf930b6bb3e22481ed34d1636272947c5bd35f7"
-"bfcf96a871533e55e2f75dffc853657e28fcebdfb16c81bb92000a4905f11a263428b6b9cdfe8a4d9e3f5cf0fdf06129c855abd6736eecb2e522d4630e70bf521ed51010ab11"
-"92084d05dd77bf386fe7de593adc3743959f97e1504986366275491f75de795f364aa7f071b82b71235ca408f38c2977363d5cd8fc3b56b31e27af60f51df6072bdf59f88e0c"
-"a8076b067bb51d7d8da651378bdfd66a54aa3df7fb0ae15006703285f61d63d0084d983af9d29d3e13241fae383ae01325b4ee274c98312d08c87371ee73879a80f5f7b1f7ae"
-"ae82ae63afe4b133b157a9c7e806918f0255ccc632e052b03207a296f8fbe89bf66aa1a41bd8a455b11e0c1ef63a8ab02e72d4f3bee729e2ddb53d9ad0c3a2248da14b6bff68"
-"7583dd0d887fded6216dc6dfea76243b83ec50e2a8e076cb0ff7e0ebfeded38ac9c4b99f3751d36c167848343091f0242492f39dd40f955b5cb7ab22a905158a6215921cef8e"
-"68eb15e2edbb3c7749bdb9f27d19e9fbcf38f67ff7a42b67880282ddead4874bc1f216249c140593a2d5f1bd4e2f0f2db634754ca1a2c852433ad4968408d11e32bbce9d54f4"
-"5f593d14ff2a6dc3be4a576ffc963ecaca34cda4a111aaf98c08f9d5473ae66bd76af07c2de4a2d45dc70779efa49b3690f1a404f79f358fbddcdfd5b3f807fa8bb7f7960221"
-"338cc46c40b2d458f107e0e8833a4abd53f85c20ab385bdf472b86b202557f9a386cf523e326da9faba8e1ab1767dc62d19a7926f905a69d4a1217f5cbf27decbb7cf5cc241e"
-"849f30f8bb57bfb85e04c68698da3a4b3ae55a0988a8a0a20debfd0c9f91f1da9af26485a7fa5b8dd6c0999de753583e9ad6da27f6daf67ac87b36eb24629e45e817c9527d7c"
-"fa230767dcb644ce4f51da32ab8f0be77d2d06884a220d02a0759280ade3c90690897ca9383c1d47c7795788fdbfc3fda184486020d0caa891012d9a7c55307f7a978ed2b15b"
-"60ef90e544d876b4315cebb21fd3dde0b8e7eb9129d73932a45c05b9509222abfb03f9e96a37e8b995fe26d5f27d8f856c8e85ce52da1ef8d0b172f69cc9d1f9ded6d17b5236"
-"2ee5fc73d17f5e5f32c787765647430358537ef60c2eb3ba54fb9d95469de9001895d53840dd82c468230204fed21771303b7b16427351277b4ec062720c6f6ad9591950eeca"
-"224029bb6637491c3d88f5960652b540c4e82304021251ff2e3f7e3ed44df885a08ab9be728532508305c4e678bc573b273847fb82a62b87d709c27a3f47799477fb8d9374c3"
-"db8bb25adf4402145e99a3dbe26e773a88c5d6b84b4bf06c61124681590c547cb398fd1b61b7019c331d468e07bbf47efdd65cbe3f1ffab66c1ba1d8489d0a27a0a8ec2484fc"
-"8ed7ffbd9f29a88caa52fd8fa2ceafc53fd656f9b0ff35c6dab06da198195306a942095148ce73fe9c8b9d086fa3c94dfa39be6d9d0c40a338c8529121472b4f2ba06c110226"
-"8c03ec3b0eaf5bd369b8c1b21d6f3bcf8ee638321428158a18c2044b41c2852847786dcfefbe582a9210912a42c6b081bef59b2a29f16b9165c050ce5e2dcf3b1f234a9dbe52"
-"e83d9ad857003ec845902fde09efd27b8caedf74daf3db8d338b1451dda4450b9de7f1f1beef096d37319a5ae37589f962e2a4bc8f45118f31f13725c181f8f907780f541b06"
-"4bebb294cff85586a8b3656a5679be6baa797fa7317fe265219d6b46f9b8f079031bdcdd6fa6681f58ebaaed76354828ffc170101b6d5b585b8dc7ecd88dcd4e03fc4a1b2eb7"
-"2e3f66f394dd0a74d3f1da878c024fd306906f4784be0f8303ed8bc0832628cc1201963182c8751d36bfa8ea18f6875379e042c0019518f346912101e2990da4bf0f7d9b8f2b"
-"bb1fe9e2aa7910c4ff04c672b58901c56dbd4dcbcff9064bad7998daebdf8d92191061fbfc01b20db58b359cf7f567c323d5c963db65e3837b682941635383381e5ae29903fd"
-"5c772f0afa0f1fe81e2a2324313efd8e2aff9adbdec937e06360e3fa91244382ffac343713cd86d7363bdba2dfa2eeb2bbac23cba5120c9897840ea74608f9dffa966ff7d84e"
-"d3d431c3e77998785b47cd8acbb3b588a81a9f4daf5d46286c7719ae4bae3f49c275c021d9abd221ea7bdc11dfd5c8f8d8bb2582d9297a6ac1f6b61d8f18bad35b5b7ed83146"
-"38a26bfc16f92f67b621f07960ef42f7e81232652df4a4e21658a08121e5dd1d7f2f513804d5864c32b1e8cef7fb6d15bd267979ae53f4cf72f523dcf1f384f0cc4d47b8d5c9"
-"e8babdf0d283642ea1d7a08f43d06708daa37290c688e6de0e63ba63b91fe5cd977a77f2c8e5697853debe5ef2f77024b05756cc9fd6ab0b8b7f6fffdc583c1a9dde9a3a8cec"
-"feff23c4d5280cf95bcf972ddafbe7f0431dfb0c273e22845ebc308647b1b306238d963540e2330f7ba17d284c8952f8f413a4038cacc4222e1efae7e12927cb0e5ddf96f293"
-"3baaf763feba4ee6698bb38385c7e5b85a6212f5b36679fe89d8f4ec83c400b2cc8f2adb07d2fe34f829af005190483e5fdfdbf6ae57ac8dce33e79b32ad57a0a34de7bd35e0"
-"bf17ff4603e2c57454ec55fdf3b23c1ef61aa3efa71ab212b26ca2ded6828190505f5636d07bb4e5a9ff22bfdbf66a5f00f9bb1d30742ff3ee070f1abf0733d1fdfcb13ca83c"
-"0d046cbf9841370195e4cc8954df581a1c3f2d1a49aca6831476f8077aaab64124515df46547bd7e4f9993a1ca41575c25f469f19e5189fbd44a43f336574df61b3eb7b879a6"
-"3f4b6023a53982b3dcfda3b173c371adef0cdde1ddcb2b68a1dc5f791b01b76697acf66c27b90fd5c517ef15c6f58a029292b5aa0bfa0d5b1093c9fabbfce27439cfd421b6ef"
-"b76558d46ceb05b28f25ce0693512accdb48fba9f9d6f16e91e1c70af830becf746a5b4360f1e767231a781a1e5a32f48325224ecb9f6da3fbf049556c27c25aa2c64d6bf8a7"
-"4f7437a5adc07e84fa7278da8fc2ef98cbe0b3e35ff5dbed39d0f2cd1002da8d2087c056e8f2f77b6ced9dc69f7ffe129030dec08272d4011122097c219d31a0257cf01a93e9"
-"221c8aa5d6d359d8d4a453e469fc190e9665ccf77e5c9a4f7d8e3c299ec5ef7058b4960abc3f54db1d93ab32cdcb8db34fb25d21c22555ce81eb869d3c0a071342f2fa70604f"
-"21925b98cd4eae0924dddbffa4a12ef7989bd31db277f3db298e6b9820e1022448040826798c0d33209caef90f34cccff2e6722449412d84698827c9954ef9e665d08363aae9"
-"26208b6f6f8dda30b5e9f75c23e589ef05044f62c3225e190a0bbb12f3f1cbbc47340029f4ab7bd3f43a5c6dbe39c73d07ebf2674e87db61c3f2b44ef927d540ee84802a8414"
-"05503ca32053093d1a4879364b3277c90a4591610e6d02991602903bf43a6d69ba8c0cfb80c11ffc5dc914e1424012dc1190"
-};
-
-#endif
-
@@ -1,87 +1,302 @@
 #include "fontloader.hh"
 #include "constants.hh"
+#include "profiler.hh"
 
-#include "../bzip2-1.0.6/bzlib.h"
-#include <memory>
-
-void printBzipError(int bzerror);
-
-// SFML requires pointed buffer to be kept alive as long as program is
-// running and will not deallocate it.
-// ImGui takes ownership of the buffer and will free it by itself
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
 
 // * everything passed to the function that is going to be modified
 //   is passed as a reference, even if it is a pointer.
-//   - these are: sfFont, imFont* and uncompBuffer
-// * if it is not going to be modified, but to avoid copying, pointers
-//   are used
-//   - this is: compData
-
-bool FontLoader::loadEmbeddedFont(sf::Font &sfFont, ImFont *&imFont,
-		std::unique_ptr<char> &uncompBuffer,
-		const char *compData, unsigned int compSize)
+//   - these are: guiFont* and labelFont*
+
+// Cache file layout: header, then each font with its glyphs, then the
+// alpha of the atlas, which goes up to the GPU as it is. The atlas baked
+// at build time, res/font-atlas.bin, is a cache file too.
+static const char cacheMagic[4] = { 'S', 'Y', 'F', 'A' };
+static const uint32_t cacheVersion = 2;
+
+struct CacheHeader {
+	char magic[4];
+	uint32_t version;
+	uint32_t glyphSize;
+	uint64_t key;
+	int32_t fontCount;
+	int32_t texWidth, texHeight;
+	float whiteU, whiteV;
+};
+
+struct CachedFont {
+	float fontSize, ascent, descent;
+	float displayOffsetX, displayOffsetY;
+	uint32_t fallbackChar;
+	int32_t glyphCount;
+};
+
+static void hash(uint64_t *key, const void *data, size_t size)
 {
-	char *compressedBuffer = new char [compSize];
-	int compressedBufferCounter = 0;
-	for (size_t i = 0; i < compSize*2; i += 2) {
-		const char byte[3] = { compData[i], compData[i+1], '\0' };
-		compressedBuffer[compressedBufferCounter++] =
-			strtol(byte, nullptr, 16);
+	const unsigned char *bytes = (const unsigned char*)data;
+	for (size_t i = 0; i < size; i++) {
+		*key ^= bytes[i];
+		*key *= 1099511628211ull;
 	}
+}
+
+static void hashConfig(uint64_t *key, const ImFontConfig &config,
+		const ImWchar *ranges)
+{
+	hash(key, &config.SizePixels, sizeof(config.SizePixels));
+	hash(key, &config.OversampleH, sizeof(config.OversampleH));
+	hash(key, &config.OversampleV, sizeof(config.OversampleV));
+	for (const ImWchar *r = ranges; r && *r; r++)
+		hash(key, r, sizeof(*r));
+}
+
+static std::string cachePath()
+{
+	std::string directory;
+	if (const char *xdg = getenv("XDG_CACHE_HOME"))
+		directory = xdg;
+	else if (const char *home = getenv("HOME"))
+		directory = std::string(home) + "/.cache";
+	else
+		directory = ".";
+	mkdir(directory.c_str(), 0755);
+	return directory + "/" + Constants.fontCacheFile;
+}
+
+// the baked atlas lives in the executable, its pixels aren't ImGui's to free
+static bool pixelsBorrowed = false;
+
+// Restores the fonts of a cache file that is already in memory. The alpha
+// is pointed at where it is when borrow is set, and copied otherwise.
+static bool readAtlas(const unsigned char *data, size_t size, uint64_t key,
+		bool borrow)
+{
+	const unsigned char *at = data, *end = data + size;
+	auto take = [&](void *out, size_t bytes) {
+		if ((size_t)(end - at) < bytes)
+			return false;
+		memcpy(out, at, bytes);
+		at += bytes;
+		return true;
+	};
 
-	uncompBuffer = std::unique_ptr<char>(new char [Constants.fontSizeGuess]);
-	unsigned int uncompSize = Constants.fontSizeGuess;
-	int bzerror = BZ2_bzBuffToBuffDecompress(
-			uncompBuffer.get(), &uncompSize,
-			compressedBuffer, compSize,
-			0, 0);
-	if (bzerror != BZ_OK) {
-		printBzipError(bzerror);
+	CacheHeader header;
+	if (!take(&header, sizeof(header)) ||
+			memcmp(header.magic, cacheMagic, sizeof(cacheMagic)) ||
+			header.version != cacheVersion ||
+			header.glyphSize != sizeof(ImFont::Glyph) ||
+			header.key != key ||
+			header.fontCount <= 0 || header.texWidth <= 0 || header.texHeight <= 0)
 		return false;
+
+	ImFontAtlas *atlas = ImGui::GetIO().Fonts;
+	atlas->Clear();
+	bool ok = true;
+	for (int i = 0; i < header.fontCount && ok; i++) {
+		CachedFont cached;
+		if (!take(&cached, sizeof(cached)) || cached.glyphCount < 0) {
+			ok = false;
+			break;
+		}
+		ImFont *font = (ImFont*)ImGui::MemAlloc(sizeof(ImFont));
+		new (font) ImFont();
+		atlas->Fonts.push_back(font);
+		font->ContainerAtlas = atlas;
+		font->FontSize = cached.fontSize;
+		font->Ascent = cached.ascent;
+		font->Descent = cached.descent;
+		font->DisplayOffset = ImVec2(cached.displayOffsetX, cached.displayOffsetY);
+		font->FallbackChar = cached.fallbackChar;
+		font->Glyphs.resize(cached.glyphCount);
+		ok = take(font->Glyphs.Data, sizeof(ImFont::Glyph)*cached.glyphCount);
+		font->BuildLookupTable();
 	}
 
-	delete [] compressedBuffer;
+	const size_t pixelCount = (size_t)header.texWidth*header.texHeight;
+	ok = ok && (size_t)(end - at) >= pixelCount;
+	if (!ok) {
+		atlas->Clear();
+		return false;
+	}
+	if (borrow) {
+		atlas->TexPixelsAlpha8 = (unsigned char*)at;
+	} else {
+		atlas->TexPixelsAlpha8 = (unsigned char*)ImGui::MemAlloc(pixelCount);
+		memcpy(atlas->TexPixelsAlpha8, at, pixelCount);
+	}
+	pixelsBorrowed = borrow;
+	atlas->TexWidth = header.texWidth;
+	atlas->TexHeight = header.texHeight;
+	atlas->TexUvWhitePixel = ImVec2(header.whiteU, header.whiteV);
+	return true;
+}
 
-	if (!sfFont.loadFromMemory(uncompBuffer.get(), uncompSize))
+static bool readCache(const std::string &path, uint64_t key)
+{
+	profiler::Zone zone(profiler::Zone_DiskIo);
+	FILE *f = fopen(path.c_str(), "rb");
+	if (!f)
 		return false;
+	std::vector<unsigned char> data;
+	unsigned char buffer[1 << 16];
+	size_t read;
+	while ((read = fread(buffer, 1, sizeof(buffer), f)) > 0)
+		data.insert(data.end(), buffer, buffer + read);
+	fclose(f);
+	if (!readAtlas(data.data(), data.size(), key, false)) {
+		puts("Font cache is stale or truncated, rebuilding it");
+		return false;
+	}
+	return true;
+}
 
-	ImFontConfig config;
-	config.FontDataOwnedByAtlas = false;
-	config.OversampleH = 8;
-	config.OversampleV = 8;
-	imFont = ImGui::GetIO().Fonts->AddFontFromMemoryTTF(uncompBuffer.get(),
-			uncompSize, Constants.gui.fontSize, &config);
+// written next to the real file and renamed over it, so a crash halfway
+// through never leaves a broken cache behind
+static bool writeCache(const std::string &path, uint64_t key)
+{
+	profiler::Zone zone(profiler::Zone_DiskIo);
+	ImFontAtlas *atlas = ImGui::GetIO().Fonts;
+	unsigned char *pixels;
+	int width, height;
+	atlas->GetTexDataAsAlpha8(&pixels, &width, &height);
+
+	const std::string temporary = path + ".tmp";
+	FILE *f = fopen(temporary.c_str(), "wb");
+	if (!f) {
+		printf("Failed to write font cache \"%s\"\n", temporary.c_str());
+		return false;
+	}
 
+	CacheHeader header;
+	memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+	header.version = cacheVersion;
+	header.glyphSize = sizeof(ImFont::Glyph);
+	header.key = key;
+	header.fontCount = atlas->Fonts.Size;
+	header.texWidth = width;
+	header.texHeight = height;
+	header.whiteU = atlas->TexUvWhitePixel.x;
+	header.whiteV = atlas->TexUvWhitePixel.y;
+	bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+
+	for (int i = 0; i < atlas->Fonts.Size && ok; i++) {
+		const ImFont *font = atlas->Fonts[i];
+		CachedFont cached;
+		cached.fontSize = font->FontSize;
+		cached.ascent = font->Ascent;
+		cached.descent = font->Descent;
+		cached.displayOffsetX = font->DisplayOffset.x;
+		cached.displayOffsetY = font->DisplayOffset.y;
+		cached.fallbackChar = font->FallbackChar;
+		cached.glyphCount = font->Glyphs.Size;
+		ok = fwrite(&cached, sizeof(cached), 1, f) == 1 &&
+			fwrite(font->Glyphs.Data, sizeof(ImFont::Glyph), font->Glyphs.Size, f) ==
+			(size_t)font->Glyphs.Size;
+	}
+	ok = ok && fwrite(pixels, 1, (size_t)width*height, f) == (size_t)width*height;
+	ok = fclose(f) == 0 && ok;
+
+	if (!ok || rename(temporary.c_str(), path.c_str())) {
+		printf("Failed to write font cache \"%s\"\n", path.c_str());
+		remove(temporary.c_str());
+		return false;
+	}
 	return true;
 }
 
-void printBzipError(int bzerror)
+// key labels only ever use these
+static const ImWchar labelRanges[] = {
+	'#', '#',
+	'-', '-',
+	'0', '9',
+	'A', 'G',
+	0
+};
+
+// what the atlas is built from, and the key of that
+static uint64_t configure(ImFontConfig *guiConfig, ImFontConfig *labelConfig,
+		const resources::Span &ttf)
 {
-	puts("Error at decompressing font data:");
-	switch (bzerror) {
-		case BZ_CONFIG_ERROR:
-			puts("The library has been mis-compiled");
-			break;
-		case BZ_PARAM_ERROR:
-			puts("Parameter error at BZ2_bzBuffToBuffDecompress");
-			break;
-		case BZ_MEM_ERROR:
-			puts("Insufficient memory available") ;
-			break;
-		case BZ_OUTBUFF_FULL:
-			puts("The size of the compressed data exceeds *destLen");
-			break;
-		case BZ_DATA_ERROR:
-			puts("A data integrity error was detected in the compressed data");
-			break;
-		case BZ_DATA_ERROR_MAGIC:
-			puts("The compressed data doesn't begin with the right bytes");
-			break;
-		case BZ_UNEXPECTED_EOF:
-			puts("The compressed data ends unexpectedly");
-			break;
-		default:
-			puts("Unhandled error code");
+	guiConfig->OversampleH = Constants.gui.fontOversample;
+	guiConfig->OversampleV = Constants.gui.fontOversample;
+	guiConfig->SizePixels = Constants.gui.fontSize;
+
+	// labels are drawn at whole pixels and at the size they were baked at,
+	// oversampling would only blur them
+	labelConfig->OversampleH = 1;
+	labelConfig->OversampleV = 1;
+	labelConfig->SizePixels = Constants.text.size;
+
+	uint64_t key = 14695981039346656037ull;
+	hash(&key, ttf.data, ttf.size);
+	hashConfig(&key, *guiConfig, nullptr);
+	hashConfig(&key, *labelConfig, labelRanges);
+	return key;
+}
+
+// "owned" keeps AddFont() from copying the TTF out of the executable,
+// ownership is taken back before anything could free it
+static bool rasterise(ImFont *&guiFont, ImFont *&labelFont,
+		ImFontConfig guiConfig, ImFontConfig labelConfig,
+		const resources::Span &ttf)
+{
+	ImFontAtlas *atlas = ImGui::GetIO().Fonts;
+	atlas->Clear();
+	pixelsBorrowed = false;
+	guiFont = atlas->AddFontFromMemoryTTF((void*)ttf.data, ttf.size,
+			guiConfig.SizePixels, &guiConfig);
+	labelFont = atlas->AddFontFromMemoryTTF((void*)ttf.data, ttf.size,
+			labelConfig.SizePixels, &labelConfig, labelRanges);
+	for (auto &config : atlas->ConfigData)
+		config.FontDataOwnedByAtlas = false;
+	return guiFont && labelFont;
+}
+
+bool FontLoader::loadEmbeddedFonts(ImFont *&guiFont, ImFont *&labelFont,
+		const resources::Span &ttf, const resources::Span &baked)
+{
+	ImFontConfig guiConfig, labelConfig;
+	const uint64_t key = configure(&guiConfig, &labelConfig, ttf);
+
+	// the baked atlas is out of date once the font or its sizes change,
+	// until it is baked again the cache file stands in for it
+	ImFontAtlas *atlas = ImGui::GetIO().Fonts;
+	const std::string path = cachePath();
+	if ((readAtlas(baked.data, baked.size, key, true) ||
+				readCache(path, key)) && atlas->Fonts.Size == 2) {
+		guiFont = atlas->Fonts[0];
+		labelFont = atlas->Fonts[1];
+		return true;
 	}
+
+	if (!rasterise(guiFont, labelFont, guiConfig, labelConfig, ttf))
+		return false;
+	writeCache(path, key);
+	return true;
 }
 
+bool FontLoader::bakeFonts(const resources::Span &ttf, const char *path)
+{
+	ImFontConfig guiConfig, labelConfig;
+	const uint64_t key = configure(&guiConfig, &labelConfig, ttf);
+	ImFont *guiFont, *labelFont;
+	if (!rasterise(guiFont, labelFont, guiConfig, labelConfig, ttf))
+		return false;
+	return writeCache(path, key);
+}
+
+void FontLoader::clearTexData()
+{
+	ImFontAtlas *atlas = ImGui::GetIO().Fonts;
+	if (pixelsBorrowed)
+		atlas->TexPixelsAlpha8 = nullptr;
+	pixelsBorrowed = false;
+	atlas->ClearTexData();
+}
@@ -1,15 +1,25 @@
 #ifndef FONTLOADER_HH
 #define FONTLOADER_HH
 
-#include <SFML/Graphics.hpp>
+#include "resources.hh"
+
 #include "../imgui/imgui.h"
 
 namespace FontLoader
 {
 
-bool loadEmbeddedFont(sf::Font &sfFont, ImFont *&imFont,
-		std::unique_ptr<char> &uncompBuffer,
-		const char *compData, unsigned int compSize);
+// Adds the font to the ImGui atlas twice, at the GUI size and at the size
+// of the key labels, and builds it. Both end up in the one single channel
+// texture. The atlas is baked at build time (make font-atlas) and comes
+// straight out of the executable; when the font or its sizes changed
+// since, it is rasterised once and kept in a cache file instead.
+bool loadEmbeddedFonts(ImFont *&guiFont, ImFont *&labelFont,
+		const resources::Span &ttf, const resources::Span &baked);
+// rasterises the atlas and writes it where loadEmbeddedFonts() can take
+// it from, for font_atlas_baker.cc
+bool bakeFonts(const resources::Span &ttf, const char *path);
+// for once the pixels are on the GPU, in place of ClearTexData()
+void clearTexData();
 
 };
 
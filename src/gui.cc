@@ -1,6 +1,15 @@
 #include "gui.hh"
 #include "constants.hh"
+#include "fontloader.hh"
+#include "profiler.hh"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+// Frames that would look the same aren't built or drawn at all, see
+// MainLoop::ShouldDraw(), so whatever gets here is uploaded
 static void ImGuiRenderDrawLists(ImDrawData *draw_data)
 {
 	Gui *gui = (Gui*)ImGui::GetIO().UserData;
@@ -31,46 +40,64 @@ static void ImGuiRenderDrawLists(ImDrawData *draw_data)
 			&ortho_projection[0][0]);
 	glBindVertexArray(gui->vaoHandle);
 
+	// All lists go into one vertex and one index buffer, uploaded at
+	// once. ImGui indices are relative to their own list, so they get
+	// rebased, which needs 32 bits; the attributes then stay where the
+	// constructor pointed them.
+	std::vector<ImDrawVert> &vertices = gui->stagingVertices;
+	std::vector<GLuint> &indices = gui->stagingIndices;
+	vertices.clear();
+	indices.clear();
+	for (int n = 0; n < draw_data->CmdListsCount; n++) {
+		const ImDrawList* cmd_list = draw_data->CmdLists[n];
+		const GLuint base = vertices.size();
+		vertices.insert(vertices.end(), cmd_list->VtxBuffer.begin(),
+				cmd_list->VtxBuffer.end());
+		for (auto idx : cmd_list->IdxBuffer)
+			indices.push_back(base + idx);
+	}
+
+	// storage is only ever grown, and orphaned before each upload so the
+	// driver doesn't wait for the previous frame to finish
+	const size_t vertexBytes = vertices.size()*sizeof(ImDrawVert),
+		indexBytes = indices.size()*sizeof(GLuint);
+	if (vertexBytes > gui->vboCapacity)
+		gui->vboCapacity = vertexBytes*2;
+	if (indexBytes > gui->elementsCapacity)
+		gui->elementsCapacity = indexBytes*2;
+	glBindBuffer(GL_ARRAY_BUFFER, gui->vboHandle);
+	glBufferData(GL_ARRAY_BUFFER, gui->vboCapacity, NULL, GL_STREAM_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, vertexBytes, vertices.data());
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, gui->elementsCapacity, NULL,
+			GL_STREAM_DRAW);
+	glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, indexBytes, indices.data());
+
+	const GLuint* idx_buffer_offset = nullptr;
 	for (int n = 0; n < draw_data->CmdListsCount; n++) {
 		const ImDrawList* cmd_list = draw_data->CmdLists[n];
-		const ImDrawIdx* idx_buffer_offset = nullptr;
-
-		glBindBuffer(GL_ARRAY_BUFFER, gui->vboHandle);
-		glBufferData(GL_ARRAY_BUFFER,
-				(GLsizeiptr)cmd_list->VtxBuffer.size()*sizeof(ImDrawVert),
-				(GLvoid*)&cmd_list->VtxBuffer.front(),
-				GL_STREAM_DRAW);
-
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gui->elementsHandle);
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-				(GLsizeiptr)cmd_list->IdxBuffer.size()*sizeof(ImDrawIdx),
-				(GLvoid*)&cmd_list->IdxBuffer.front(),
-				GL_STREAM_DRAW);
-
-			for (const ImDrawCmd *pcmd = cmd_list->CmdBuffer.begin();
-					pcmd != cmd_list->CmdBuffer.end();
-					pcmd++)
-			{
-				if (pcmd->UserCallback) {
-					pcmd->UserCallback(cmd_list, pcmd);
-				} else {
-					glBindTexture(GL_TEXTURE_2D,
-							(GLuint)(intptr_t)pcmd->TextureId);
-					glScissor((int)pcmd->ClipRect.x,
-							(int)(height - pcmd->ClipRect.w),
-							(int)(pcmd->ClipRect.z - pcmd->ClipRect.x),
-							(int)(pcmd->ClipRect.w - pcmd->ClipRect.y));
-					glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount,
-							GL_UNSIGNED_SHORT, idx_buffer_offset);
-				}
-				idx_buffer_offset += pcmd->ElemCount;
+		for (const ImDrawCmd *pcmd = cmd_list->CmdBuffer.begin();
+				pcmd != cmd_list->CmdBuffer.end();
+				pcmd++)
+		{
+			if (pcmd->UserCallback) {
+				pcmd->UserCallback(cmd_list, pcmd);
+			} else {
+				glBindTexture(GL_TEXTURE_2D,
+						(GLuint)(intptr_t)pcmd->TextureId);
+				glScissor((int)pcmd->ClipRect.x,
+						(int)(height - pcmd->ClipRect.w),
+						(int)(pcmd->ClipRect.z - pcmd->ClipRect.x),
+						(int)(pcmd->ClipRect.w - pcmd->ClipRect.y));
+				glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount,
+						GL_UNSIGNED_INT, idx_buffer_offset);
 			}
+			idx_buffer_offset += pcmd->ElemCount;
+		}
 	}
 
 	// Restore modified state
 	glBindVertexArray(0);
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 	glUseProgram(last_program);
 	glDisable(GL_SCISSOR_TEST);
 	glBindTexture(GL_TEXTURE_2D, last_texture);
@@ -84,16 +111,23 @@ Gui::Gui()
 		throw;
 	}
 
-	// editingBuffer = new char [16*1024];
-
-	fontTexture = 0;
 	shaderHandle = 0, vertHandle = 0, fragHandle = 0;
 	attribLocationTex = 0, attribLocationProjMtx = 0;
 	attribLocationPosition = 0, attribLocationUV = 0, attribLocationColor = 0;
 	vboHandle = 0, vaoHandle = 0, elementsHandle = 0;
+	vboCapacity = 0, elementsCapacity = 0;
 
 	waveOpen = true;
 	settingsOpen = false;
+	pianoRollOpen = false;
+	performanceOpen = false;
+
+	pianoRollScroll = 0;
+	pianoRollVisible = Constants.gui.pianoRoll.visibleSeconds;
+	pianoRollFollow = true;
+	previewedSamples = -1;
+	expandHeaders = false;
+	scopeWindow = Constants.audio.blockSize*4;
 
 	mousePosX = 0;
 	mousePosY = 0;
@@ -142,6 +176,7 @@ Gui::Gui()
 		"	gl_Position = ProjMtx * vec4(Position.xy,0,1);\n"
 		"}\n";
 
+	// the font atlas is single channel, all there is to it is alpha
 	const GLchar* fragment_shader =
 		"#version 120\n"
 		"uniform sampler2D Texture;\n"
@@ -149,7 +184,8 @@ Gui::Gui()
 		"varying vec4 Frag_Color;\n"
 		"void main()\n"
 		"{\n"
-		"	gl_FragColor = Frag_Color * texture2D(Texture, Frag_UV.st);\n"
+		"	gl_FragColor = vec4(Frag_Color.rgb,\n"
+		"		Frag_Color.a * texture2D(Texture, Frag_UV.st).a);\n"
 		"}\n";
 
 	shaderHandle = glCreateProgram();
@@ -176,7 +212,27 @@ Gui::Gui()
 	glGenBuffers(1, &vboHandle);
 	glGenBuffers(1, &elementsHandle);
 
+	// the element buffer binding and the attributes are VAO state, so
+	// they are set up once here and never again: every frame's lists
+	// share one vertex buffer with indices rebased to it, see
+	// ImGuiRenderDrawLists()
 	glGenVertexArrays(1, &vaoHandle);
+	glBindVertexArray(vaoHandle);
+	glBindBuffer(GL_ARRAY_BUFFER, vboHandle);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementsHandle);
+	glEnableVertexAttribArray(attribLocationPosition);
+	glEnableVertexAttribArray(attribLocationUV);
+	glEnableVertexAttribArray(attribLocationColor);
+#define OFFSETOF(TYPE, ELEMENT) ((size_t)&(((TYPE *)0)->ELEMENT))
+	glVertexAttribPointer(attribLocationPosition, 2, GL_FLOAT, GL_FALSE,
+			sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, pos));
+	glVertexAttribPointer(attribLocationUV, 2, GL_FLOAT, GL_FALSE,
+			sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, uv));
+	glVertexAttribPointer(attribLocationColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,
+			sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, col));
+#undef OFFSETOF
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
 void Gui::checkShaderCompileSuccess(int shader)
@@ -206,9 +262,11 @@ void Gui::checkProgramLinkSuccess(int program)
 	}
 }
 
-void Gui::MainMenuBar()
+void Gui::MainMenuBar(Engine *engine)
 {
 	if (ImGui::BeginMainMenuBar()) {
+		auto previousMode = Globals.mode;
+
 		if (ImGui::BeginMenu("Sythin2")) {
 			ImGui::MenuItem("Show Demo window", NULL, &Globals.showDemo);
 			if (ImGui::MenuItem("Quit", NULL))
@@ -277,10 +335,57 @@ void Gui::MainMenuBar()
 
 		ImGui::PopStyleVar(3);
 
+		if (previousMode == GlobalsHolder::Mode_Repeating &&
+				Globals.mode != GlobalsHolder::Mode_Repeating)
+			engine->LooperAction(Looper::Action_Stop);
+		if (Globals.mode == GlobalsHolder::Mode_Repeating)
+			looperControls(engine);
+
 		ImGui::EndMainMenuBar();
 	}
 }
 
+void Gui::looperControls(Engine *engine)
+{
+	const Looper &looper = engine->looper;
+
+	ImGui::SameLine(0, Constants.gui.menuBar.looperSpacing);
+	switch (looper.GetState()) {
+		case Looper::State_Empty:
+			if (ImGui::Button("Record"))
+				engine->LooperAction(Looper::Action_Record);
+			break;
+		case Looper::State_Recording:
+			if (ImGui::Button("Close loop"))
+				engine->LooperAction(Looper::Action_CloseLoop);
+			break;
+		case Looper::State_Overdubbing:
+		case Looper::State_Playing:
+			if (ImGui::Button("Stop"))
+				engine->LooperAction(Looper::Action_Stop);
+			ImGui::SameLine();
+			if (ImGui::Button(looper.GetState() == Looper::State_Overdubbing ?
+						"Stop overdub" : "Overdub"))
+				engine->LooperAction(Looper::Action_Overdub);
+			break;
+		case Looper::State_Stopped:
+			if (ImGui::Button("Play"))
+				engine->LooperAction(Looper::Action_Play);
+			break;
+	}
+
+	if (looper.GetState() != Looper::State_Empty) {
+		ImGui::SameLine();
+		if (ImGui::Button("Clear"))
+			engine->LooperAction(Looper::Action_Clear);
+	}
+
+	ImGui::SameLine();
+	ImGui::Text("layers: %d  %.1f/%.1fs", looper.GetLayers(),
+			looper.GetPosition()/(double)Constants.samplesPerSecond,
+			looper.GetLength()/(double)Constants.samplesPerSecond);
+}
+
 void Gui::TabBar()
 {
 	bool opened = true;
@@ -310,11 +415,18 @@ void Gui::TabBar()
 		ImGui::PushStyleColor(ImGuiCol_Button, Constants.gui.tabs.idle);
 		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, Constants.gui.tabs.hovered);
 	}
-	if (ImGui::Button("Wave")) {
-		Globals.tab = GlobalsHolder::Tab_Wave;
-		settingsOpen = false;
-		waveOpen = true;
+	if (ImGui::Button("Wave"))
+		SelectTab(GlobalsHolder::Tab_Wave);
+	ImGui::SameLine();
+	if (Globals.tab == GlobalsHolder::Tab_PianoRoll) {
+		ImGui::PushStyleColor(ImGuiCol_Button, Constants.gui.tabs.active);
+		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, Constants.gui.tabs.active);
+	} else {
+		ImGui::PushStyleColor(ImGuiCol_Button, Constants.gui.tabs.idle);
+		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, Constants.gui.tabs.hovered);
 	}
+	if (ImGui::Button("Roll"))
+		SelectTab(GlobalsHolder::Tab_PianoRoll);
 	ImGui::SameLine();
 	if (Globals.tab == GlobalsHolder::Tab_Settings) {
 		ImGui::PushStyleColor(ImGuiCol_Button, Constants.gui.tabs.active);
@@ -323,16 +435,40 @@ void Gui::TabBar()
 		ImGui::PushStyleColor(ImGuiCol_Button, Constants.gui.tabs.idle);
 		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, Constants.gui.tabs.hovered);
 	}
-	if (ImGui::Button("Settings")) {
-		Globals.tab = GlobalsHolder::Tab_Settings;
-		settingsOpen = true;
-		waveOpen = false;
+	if (ImGui::Button("Settings"))
+		SelectTab(GlobalsHolder::Tab_Settings);
+	ImGui::SameLine();
+	if (Globals.tab == GlobalsHolder::Tab_Performance) {
+		ImGui::PushStyleColor(ImGuiCol_Button, Constants.gui.tabs.active);
+		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, Constants.gui.tabs.active);
+	} else {
+		ImGui::PushStyleColor(ImGuiCol_Button, Constants.gui.tabs.idle);
+		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, Constants.gui.tabs.hovered);
 	}
-	ImGui::PopStyleColor(2*2+1);
+	if (ImGui::Button("Performance"))
+		SelectTab(GlobalsHolder::Tab_Performance);
+	ImGui::PopStyleColor(4*2+1);
 
 	ImGui::End();
 }
 
+void Gui::SelectTab(GlobalsHolder::Tab tab)
+{
+	Globals.tab = tab;
+	waveOpen = tab == GlobalsHolder::Tab_Wave;
+	pianoRollOpen = tab == GlobalsHolder::Tab_PianoRoll;
+	settingsOpen = tab == GlobalsHolder::Tab_Settings;
+	performanceOpen = tab == GlobalsHolder::Tab_Performance;
+}
+
+// the benchmark has every header open to have everything in them drawn
+bool Gui::SettingsHeader(const char *label)
+{
+	if (expandHeaders)
+		ImGui::SetNextTreeNodeOpened(true, ImGuiSetCond_Always);
+	return ImGui::CollapsingHeader(label);
+}
+
 bool Gui::BeginSettingsWindow()
 {
 	if (!settingsOpen)
@@ -376,9 +512,6 @@ void Gui::WaveWindow(bool *shouldCompile)
 	ImGui::Begin("Wave", &waveOpen,
 			windowSize, Constants.gui.alpha, windowFlags);
 
-	for (size_t i = 0; i < 16*1024; i++)
-		editingBuffer[i] = '\0';
-
 	WaveWindowFileOps();
 
 	ImGui::SameLine();
@@ -388,9 +521,16 @@ void Gui::WaveWindow(bool *shouldCompile)
 		*shouldCompile = true;
 	ImGui::PopStyleVar();
 
-	ImGui::InputTextMultiline("##source", editingBuffer, 16*1024,
-			ImVec2(-1.0f, ImGui::GetTextLineHeight()*10),
-			ImGuiInputTextFlags_AllowTabInput);
+	if (Globals.compiling) {
+		ImGui::SameLine();
+		ImGui::Text("compiling...");
+	}
+	if (!Globals.errorMessage.empty())
+		ImGui::TextColored(ImVec4(1, 0.3, 0.3, 1), "Error: %s",
+				Globals.errorMessage.c_str());
+
+	editor.Draw("##source", ImVec2(-1.0f,
+				ImGui::GetTextLineHeight()*Constants.gui.editor.visibleLines));
 
 	ImGui::End();
 }
@@ -401,8 +541,8 @@ void Gui::WaveWindowFileOps()
 	static bool once = true;
 
 	if (once) {
+		profiler::Zone zone(profiler::Zone_DiskIo);
 		once = false;
-		memset(editingBuffer, 0, 16*1024);
 		FILE *f = fopen("wave.lua", "rb");
 		if (!f) {
 			f = fopen("wave.lua", "wb");
@@ -417,11 +557,13 @@ void Gui::WaveWindowFileOps()
 		fseek(f, 0, SEEK_END);
 		size_t fileSize = ftell(f);
 		rewind(f);
-		if (fread(editingBuffer, 1, fileSize, f) != fileSize) {
+		std::vector<char> source(fileSize);
+		if (fread(source.data(), 1, fileSize, f) != fileSize) {
 			failedToSave = false;
 			failedToRead = true;
 		}
 		fclose(f);
+		editor.SetText(source.data(), source.size());
 	}
 	if (failedToSave) {
 		ImGui::TextColored(ImVec4(1, 0.3, 0.3, 1),
@@ -444,12 +586,15 @@ void Gui::WaveWindowFileOps()
 		if (ImGui::Selectable("New"))
 			newPopup = true;
 		if (ImGui::Selectable("Save")) {
+			profiler::Zone zone(profiler::Zone_DiskIo);
 			FILE *f = fopen("wave.lua", "wb");
 			if (!f) {
 				failedToSave = true;
 				failedToRead = false;
 			}
-			fputs(editingBuffer, f);
+			std::string source;
+			editor.GetText(&source);
+			fwrite(source.data(), 1, source.size(), f);
 			fclose(f);
 		}
 		if (ImGui::Selectable("Reopen"))
@@ -467,7 +612,8 @@ void Gui::WaveWindowFileOps()
 				"This operation cannot be undone!\n");
 		// ImGui::Separator();
 		if (ImGui::Button("OK", ImVec2(120,0))) {
-			strncpy(editingBuffer, Constants.defaultWaveScript, 16*1024);
+			editor.SetText(Constants.defaultWaveScript,
+					strlen(Constants.defaultWaveScript));
 			ImGui::CloseCurrentPopup();
 		}
 		ImGui::SameLine();
@@ -496,6 +642,396 @@ void Gui::WaveWindowFileOps()
 	}
 }
 
+// Only the visible part of the take is ever touched: zoomed in, events are
+// pulled from the take's interval index; zoomed out, each pitch row is
+// drawn from the coarsest density level whose bins are still a few pixels
+// wide. Either way the amount of emitted quads is bounded by the size of
+// the canvas and not by the length of the take.
+void Gui::PianoRollWindow(Take *take, double now)
+{
+	if (!pianoRollOpen)
+		return;
+	ImVec2 windowSize(Globals.windowWidth - Constants.padding -
+			Constants.gui.width - Constants.padding - Constants.padding,
+			400);
+	ImGuiWindowFlags windowFlags =
+		ImGuiWindowFlags_NoResize |
+		ImGuiWindowFlags_NoMove |
+		ImGuiWindowFlags_NoCollapse;
+
+	ImVec2 windowPos(
+			Constants.padding,
+			Constants.padding + Constants.gui.menuBarGuiOffset);
+	ImGui::SetWindowPos("Piano roll", windowPos, ImGuiSetCond_Always);
+
+	ImGui::Begin("Piano roll", &pianoRollOpen,
+			windowSize, Constants.gui.alpha, windowFlags);
+
+	if (ImGui::Button("Clear"))
+		take->Clear();
+	ImGui::SameLine();
+	ImGui::Checkbox("follow", &pianoRollFollow);
+	ImGui::SameLine();
+	ImGui::Text("%d notes, %.1fs", (int)take->GetEventCount(),
+			take->GetLength());
+
+	const ImVec2 origin = ImGui::GetCursorScreenPos();
+	const ImVec2 size = ImGui::GetContentRegionAvail();
+	ImGui::InvisibleButton("##canvas", size);
+
+	const float pixelsPerSecond = size.x/pianoRollVisible;
+	ImGuiIO& io = ImGui::GetIO();
+	if (ImGui::IsItemHovered() && io.MouseWheel != 0) {
+		const float mouseTime = pianoRollScroll +
+			(io.MousePos.x - origin.x)/pixelsPerSecond;
+		pianoRollVisible *= pow(Constants.gui.pianoRoll.zoomStep,
+				-io.MouseWheel);
+		if (pianoRollVisible < Constants.gui.pianoRoll.minVisibleSeconds)
+			pianoRollVisible = Constants.gui.pianoRoll.minVisibleSeconds;
+		if (pianoRollVisible > Constants.gui.pianoRoll.maxVisibleSeconds)
+			pianoRollVisible = Constants.gui.pianoRoll.maxVisibleSeconds;
+		pianoRollScroll = mouseTime -
+			(io.MousePos.x - origin.x)*pianoRollVisible/size.x;
+	}
+	if (ImGui::IsItemActive() && ImGui::IsMouseDragging()) {
+		pianoRollScroll -= ImGui::GetMouseDragDelta().x*pianoRollVisible/size.x;
+		ImGui::ResetMouseDragDelta();
+		pianoRollFollow = false;
+	}
+	if (pianoRollFollow && now > pianoRollScroll + pianoRollVisible)
+		pianoRollScroll = now - pianoRollVisible;
+	if (pianoRollScroll < 0)
+		pianoRollScroll = 0;
+
+	ImDrawList *drawList = ImGui::GetWindowDrawList();
+	const ImVec2 end(origin.x + size.x, origin.y + size.y);
+	drawList->PushClipRect(ImVec4(origin.x, origin.y, end.x, end.y));
+	drawList->AddRectFilled(origin, end, Constants.gui.pianoRoll.background);
+
+	int lowestPitch, highestPitch;
+	if (take->GetPitchRange(&lowestPitch, &highestPitch)) {
+		const float rowHeight = size.y/(highestPitch - lowestPitch + 1);
+		const float scrolledX = origin.x - pianoRollScroll*pixelsPerSecond;
+
+		for (int p = lowestPitch; p <= highestPitch; p++) {
+			const int pitchClass = p % 12;
+			if (pitchClass == 1 || pitchClass == 3 || pitchClass == 6 ||
+					pitchClass == 8 || pitchClass == 10) {
+				const float y = origin.y + (highestPitch - p)*rowHeight;
+				drawList->AddRectFilled(ImVec2(origin.x, y),
+						ImVec2(end.x, y + rowHeight),
+						Constants.gui.pianoRoll.sharpRow);
+			}
+		}
+
+		const float pixelsPerBin = take->GetBinWidth(0)*pixelsPerSecond;
+		int level = 0;
+		while (level < 30 && pixelsPerBin*(1 << level) <
+				Constants.gui.pianoRoll.minBlockPixels)
+			level++;
+
+		bool drawn = false;
+		if (level == 0) {
+			visibleEvents.clear();
+			take->Query(pianoRollScroll, pianoRollScroll + pianoRollVisible,
+					visibleEvents);
+			if ((int)visibleEvents.size() <= Constants.gui.pianoRoll.maxBlocks) {
+				drawTakeEvents(drawList, ImVec2(scrolledX, origin.y),
+						pixelsPerSecond, rowHeight, highestPitch);
+				drawn = true;
+			}
+		}
+		while (!drawn) {
+			drawn = drawTakeDensity(drawList, take, ImVec2(scrolledX, origin.y),
+					pixelsPerSecond, rowHeight, lowestPitch, highestPitch, level);
+			level++;
+		}
+
+		for (int p = lowestPitch; p <= highestPitch; p++) {
+			if (take->GetOpenStart(p) < 0)
+				continue;
+			const float y = origin.y + (highestPitch - p)*rowHeight;
+			drawList->AddRectFilled(
+					ImVec2(scrolledX + take->GetOpenStart(p)*pixelsPerSecond, y),
+					ImVec2(scrolledX + now*pixelsPerSecond, y + rowHeight),
+					Constants.gui.pianoRoll.openNote);
+		}
+	}
+
+	if (Globals.mode == GlobalsHolder::Mode_Writing) {
+		const float x = origin.x + (now - pianoRollScroll)*pixelsPerSecond;
+		drawList->AddLine(ImVec2(x, origin.y), ImVec2(x, end.y),
+				Constants.gui.pianoRoll.playhead);
+	}
+
+	drawList->PopClipRect();
+
+	ImGui::End();
+}
+
+// A few notes spread over the whole keyboard.
+void Gui::SetPreviews(const std::vector<Note> &notes,
+		const std::vector<WaveSummary> &summaries)
+{
+	const size_t count = std::min(notes.size(), summaries.size());
+	if (count == 0)
+		return;
+	const int shown = std::min((int)count, Constants.gui.previewNotes);
+	previews.resize(shown);
+	for (int i = 0; i < shown; i++) {
+		const size_t n = shown > 1 ? i*(count - 1)/(shown - 1) : 0;
+		char label[16];
+		snprintf(label, sizeof(label), "%c%s%d", notes[n].letter,
+				notes[n].accidental == '#' ? "#" : "", notes[n].octave);
+		previews[i].label = label;
+		previews[i].summary = summaries[n];
+	}
+	previewedSamples = -1;
+}
+
+// The points are only read from the summaries again when the amount of
+// samples or the notes change, every other frame just plots them.
+void Gui::NotePreviews(int samplesInPreview)
+{
+	if (samplesInPreview != previewedSamples) {
+		previewedSamples = samplesInPreview;
+		for (auto &preview : previews) {
+			preview.values.resize(2*Constants.gui.previewPoints);
+			preview.rms = preview.summary.Points(samplesInPreview,
+					Constants.gui.previewPoints, preview.values.data());
+		}
+	}
+	for (auto &preview : previews) {
+		char overlay[32];
+		snprintf(overlay, sizeof(overlay), "rms %.0f", preview.rms);
+		ImGui::PlotLines(preview.label.c_str(), preview.values.data(),
+				preview.values.size(), 0, overlay, -32767, 32767,
+				ImVec2(0, Constants.gui.graphHeight));
+	}
+}
+
+// Zones are only recorded while this tab is open, see the main loop.
+void Gui::PerformanceWindow()
+{
+	if (!performanceOpen)
+		return;
+	ImVec2 windowSize(Globals.windowWidth - Constants.padding -
+			Constants.gui.width - Constants.padding - Constants.padding,
+			400);
+	ImGuiWindowFlags windowFlags =
+		ImGuiWindowFlags_NoResize |
+		ImGuiWindowFlags_NoMove |
+		ImGuiWindowFlags_NoCollapse;
+
+	ImVec2 windowPos(
+			Constants.padding,
+			Constants.padding + Constants.gui.menuBarGuiOffset);
+	ImGui::SetWindowPos("Performance", windowPos, ImGuiSetCond_Always);
+
+	ImGui::Begin("Performance", &performanceOpen,
+			windowSize, Constants.gui.alpha, windowFlags);
+
+	ImGui::Columns(5, "zones");
+	ImGui::Text("zone");
+	ImGui::NextColumn();
+	ImGui::Text("calls/s");
+	ImGui::NextColumn();
+	ImGui::Text("average");
+	ImGui::NextColumn();
+	ImGui::Text("max");
+	ImGui::NextColumn();
+	ImGui::Text("time");
+	ImGui::NextColumn();
+	ImGui::Separator();
+	const profiler::ZoneStats *stats = profiler::Stats();
+	const float seconds = 4*Constants.profiler.periodMilliseconds/1000.;
+	for (int z = 0; z < profiler::ZoneCount; z++) {
+		if (!stats[z].name)
+			continue;
+		ImGui::Text("%s", stats[z].name);
+		ImGui::NextColumn();
+		ImGui::Text("%.0f", stats[z].calls/seconds);
+		ImGui::NextColumn();
+		ImGui::Text("%.1f us", stats[z].averageMicroseconds);
+		ImGui::NextColumn();
+		ImGui::Text("%.1f us", stats[z].maxMicroseconds);
+		ImGui::NextColumn();
+		ImGui::Text("%.1f%%", stats[z].percent);
+		ImGui::NextColumn();
+	}
+	ImGui::Columns(1);
+	if (int dropped = profiler::Dropped())
+		ImGui::TextColored(ImVec4(1, 0.3, 0.3, 1), "%d records dropped", dropped);
+
+	ImGui::Spacing();
+
+	const ImVec2 origin = ImGui::GetCursorScreenPos();
+	const ImVec2 size = ImGui::GetContentRegionAvail();
+	ImGui::InvisibleButton("##strip", size);
+	drawFlameStrip(ImGui::GetWindowDrawList(), origin, size);
+
+	ImGui::End();
+}
+
+// The last stripMilliseconds of every thread, the newest on the right; a
+// thread gets a band with a row per nesting depth.
+void Gui::drawFlameStrip(ImDrawList *drawList, ImVec2 origin, ImVec2 size)
+{
+	const ImVec2 end(origin.x + size.x, origin.y + size.y);
+	drawList->PushClipRect(ImVec4(origin.x, origin.y, end.x, end.y));
+	drawList->AddRectFilled(origin, end, Constants.gui.performance.background);
+
+	const int64_t now = profiler::LastCollected();
+	const float pixelsPerMicrosecond =
+		size.x/(Constants.profiler.stripMilliseconds*1000.f);
+	const float rowHeight = Constants.gui.performance.rowHeight;
+	float y = origin.y;
+	for (auto &strip : profiler::Strips()) {
+		drawList->AddText(ImVec2(origin.x + 2, y), Constants.gui.performance.label,
+				strip.name.c_str());
+		y += ImGui::GetTextLineHeight();
+		for (auto &record : strip.records) {
+			const float x0 = end.x - (now - record.start)*pixelsPerMicrosecond,
+				x1 = std::max(x0 + 1, end.x - (now - record.end)*pixelsPerMicrosecond);
+			const float top = y + record.depth*rowHeight;
+			drawList->AddRectFilled(ImVec2(x0, top), ImVec2(x1, top + rowHeight - 1),
+					ImColor::HSV(record.id/(float)profiler::ZoneCount, 0.5, 0.8));
+			if (x1 - x0 >= Constants.gui.performance.minLabelPixels)
+				drawList->AddText(ImVec2(std::max(x0, origin.x) + 2, top),
+						Constants.gui.performance.label,
+						profiler::Stats()[record.id].name);
+		}
+		y += (strip.maxDepth + 1)*rowHeight + Constants.padding;
+	}
+
+	drawList->PopClipRect();
+}
+
+// Both views are a fixed amount of columns, so what they cost doesn't
+// depend on how much of the output is shown.
+void Gui::OutputScope(Scope *scope)
+{
+	ImGui::SliderFloat("window", &scopeWindow,
+			Constants.gui.scope.minWindowSamples,
+			Constants.gui.scope.maxWindowSamples,
+			"%.0f samples", Constants.gui.scope.windowPower);
+
+	const float width = ImGui::GetContentRegionAvail().x,
+		height = Constants.gui.scope.height;
+	const int columns = width > 1 ? width : 1;
+	scopeMins.resize(columns);
+	scopeMaxs.resize(columns);
+	spectrumDecibels.resize(columns);
+	ImDrawList *drawList = ImGui::GetWindowDrawList();
+
+	ImVec2 origin = ImGui::GetCursorScreenPos();
+	ImGui::InvisibleButton("##scope", ImVec2(width, height));
+	scope->Columns(scopeWindow, columns, scopeMins.data(), scopeMaxs.data());
+	drawList->AddRectFilled(origin, ImVec2(origin.x + width, origin.y + height),
+			Constants.gui.scope.background);
+	const float middle = origin.y + height/2;
+	drawList->AddLine(ImVec2(origin.x, middle), ImVec2(origin.x + width, middle),
+			Constants.gui.scope.axis);
+	for (int c = 0; c < columns; c++) {
+		const float x = origin.x + c;
+		const float y0 = middle - scopeMaxs[c]*height/2,
+			y1 = middle - scopeMins[c]*height/2;
+		drawList->AddRectFilled(ImVec2(x, y0), ImVec2(x + 1, y1 + 1),
+				Constants.gui.scope.trace);
+	}
+
+	ImGui::Spacing();
+
+	origin = ImGui::GetCursorScreenPos();
+	ImGui::InvisibleButton("##spectrum", ImVec2(width, height));
+	scope->Spectrum(columns, Constants.gui.scope.minHz, spectrumDecibels.data());
+	const float bottom = origin.y + height;
+	drawList->AddRectFilled(origin, ImVec2(origin.x + width, bottom),
+			Constants.gui.scope.background);
+	for (int decibels = -20; decibels > Constants.gui.scope.minDecibels;
+			decibels -= 20) {
+		const float y = origin.y + decibels/Constants.gui.scope.minDecibels*height;
+		drawList->AddLine(ImVec2(origin.x, y), ImVec2(origin.x + width, y),
+				Constants.gui.scope.axis);
+	}
+	for (int c = 0; c < columns; c++) {
+		float level = 1 - spectrumDecibels[c]/Constants.gui.scope.minDecibels;
+		if (level <= 0)
+			continue;
+		if (level > 1)
+			level = 1;
+		drawList->AddRectFilled(ImVec2(origin.x + c, bottom - level*height),
+				ImVec2(origin.x + c + 1, bottom), Constants.gui.scope.spectrum);
+	}
+}
+
+void Gui::drawTakeEvents(ImDrawList *drawList, ImVec2 origin,
+		float pixelsPerSecond, float rowHeight, int highestPitch)
+{
+	for (auto event : visibleEvents) {
+		const float y = origin.y + (highestPitch - event->pitch)*rowHeight;
+		float x1 = origin.x + event->end*pixelsPerSecond;
+		const float x0 = origin.x + event->start*pixelsPerSecond;
+		if (x1 < x0 + 1)
+			x1 = x0 + 1;
+		drawList->AddRectFilled(ImVec2(x0, y), ImVec2(x1, y + rowHeight),
+				Constants.gui.pianoRoll.note);
+	}
+}
+
+// Returns false when this level would emit too many blocks, in which case
+// the caller should retry one level coarser
+bool Gui::drawTakeDensity(ImDrawList *drawList, const Take *take,
+		ImVec2 origin, float pixelsPerSecond, float rowHeight, int lowestPitch,
+		int highestPitch, int level)
+{
+	const int levels = take->GetLevelCount();
+	if (levels == 0)
+		return true;
+	if (level >= levels)
+		level = levels - 1;
+	const double binWidth = take->GetBinWidth(level);
+	const int bins = take->GetBinCount(level);
+	int firstBin = pianoRollScroll/binWidth;
+	int lastBin = (pianoRollScroll + pianoRollVisible)/binWidth;
+	if (lastBin >= bins)
+		lastBin = bins - 1;
+	const int rows = highestPitch - lowestPitch + 1;
+	if ((lastBin - firstBin + 1)*rows > Constants.gui.pianoRoll.maxBlocks &&
+			level < levels - 1)
+		return false;
+
+	const ImVec4 noteColor = Constants.gui.pianoRoll.note;
+	for (int p = lowestPitch; p <= highestPitch; p++) {
+		const float y = origin.y + (highestPitch - p)*rowHeight;
+		int runStart = firstBin;
+		unsigned runDensity = 0;
+		// neighbouring bins of the same density become a single quad
+		for (int b = firstBin; b <= lastBin + 1; b++) {
+			unsigned density = b <= lastBin ?
+				take->GetDensity(level, b, p) : 0;
+			if (density > Constants.gui.pianoRoll.fullDensity)
+				density = Constants.gui.pianoRoll.fullDensity;
+			if (density == runDensity)
+				continue;
+			if (runDensity > 0) {
+				ImVec4 color = noteColor;
+				color.w = (float)runDensity/Constants.gui.pianoRoll.fullDensity;
+				drawList->AddRectFilled(
+						ImVec2(origin.x + runStart*binWidth*pixelsPerSecond, y),
+						ImVec2(origin.x + b*binWidth*pixelsPerSecond, y + rowHeight),
+						ImGui::ColorConvertFloat4ToU32(color));
+			}
+			runStart = b;
+			runDensity = density;
+		}
+	}
+	return true;
+}
+
+// The atlas goes up as GL_ALPHA, a quarter of RGBA. SFML draws the key
+// labels from it with GL_MODULATE, which leaves their vertex colour alone
+// and multiplies its alpha, and ImGui's shader does the same.
 void Gui::CreateFontTexture(ImFont *imFont)
 {
 	font = imFont;
@@ -504,16 +1040,25 @@ void Gui::CreateFontTexture(ImFont *imFont)
 
 	unsigned char *pixels;
 	int width, height;
-	io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+	io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height);
 
-	glGenTextures(1, &fontTexture);
-	glBindTexture(GL_TEXTURE_2D, fontTexture);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA,
+	if (!fontTexture.create(width, height)) {
+		puts("Failed to create font texture");
+		throw;
+	}
+	sf::Texture::bind(&fontTexture);
+	GLint alignment;
+	glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA8, width, height, 0, GL_ALPHA,
 			GL_UNSIGNED_BYTE, pixels);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+	sf::Texture::bind(nullptr);
+	fontTexture.setSmooth(true);
+	// the pixels are on the GPU now, and in the executable or the cache file
+	FontLoader::clearTexData();
 
-	io.Fonts->TexID = (void*)(intptr_t)fontTexture;
+	io.Fonts->TexID = (void*)(intptr_t)fontTexture.getNativeHandle();
 }
 
 void Gui::Update(int dt)
@@ -527,29 +1072,12 @@ void Gui::Update(int dt)
 
 void Gui::Draw()
 {
-	glBindVertexArray(vaoHandle);
-	glBindBuffer(GL_ARRAY_BUFFER, vboHandle);
-	glEnableVertexAttribArray(attribLocationPosition);
-	glEnableVertexAttribArray(attribLocationUV);
-	glEnableVertexAttribArray(attribLocationColor);
-#define OFFSETOF(TYPE, ELEMENT) ((size_t)&(((TYPE *)0)->ELEMENT))
-	glVertexAttribPointer(attribLocationPosition, 2, GL_FLOAT, GL_FALSE,
-			sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, pos));
-	glVertexAttribPointer(attribLocationUV, 2, GL_FLOAT, GL_FALSE,
-			sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, uv));
-	glVertexAttribPointer(attribLocationColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,
-			sizeof(ImDrawVert), (GLvoid*)OFFSETOF(ImDrawVert, col));
-#undef OFFSETOF
-	glBindVertexArray(0);
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-
+	profiler::Zone zone(profiler::Zone_ImGuiRender);
 	ImGui::Render();
 }
 
 Gui::~Gui()
 {
-	// delete [] editingBuffer;
-
 	if (vaoHandle) glDeleteVertexArrays(1, &vaoHandle);
 	if (vboHandle) glDeleteBuffers(1, &vboHandle);
 	if (elementsHandle) glDeleteBuffers(1, &elementsHandle);
@@ -568,13 +1096,9 @@ Gui::~Gui()
 
 	ImGuiIO& io = ImGui::GetIO();
 	io.Fonts->ClearInputData();
-	io.Fonts->ClearTexData();
+	FontLoader::clearTexData();
 
-	if (fontTexture) {
-		glDeleteTextures(1, &fontTexture);
-		ImGui::GetIO().Fonts->TexID = 0;
-		fontTexture = 0;
-	}
+	ImGui::GetIO().Fonts->TexID = 0;
 	ImGui::Shutdown();
 }
 
@@ -1,25 +1,63 @@
 #ifndef GUI_HH
 #define GUI_HH
 
+#include "constants.hh"
+#include "editor.hh"
+#include "engine.hh"
+#include "scope.hh"
+#include "summary.hh"
+#include "take.hh"
+
 #include <GL/glew.h>
+#include <SFML/Graphics.hpp>
 #include "../imgui/imgui.h"
 #include <memory>
+#include <string>
+#include <vector>
 
 class Gui
 {
 	ImFont *font;
-	char editingBuffer[16*1024];
+	Editor editor;
+
+	float pianoRollScroll, pianoRollVisible;
+	bool pianoRollFollow;
+	std::vector<const Take::Event*> visibleEvents;
+
+	struct NotePreview {
+		std::string label;
+		WaveSummary summary;
+		std::vector<float> values;
+		float rms;
+	};
+	std::vector<NotePreview> previews;
+	int previewedSamples;
+
+	float scopeWindow;
+	std::vector<float> scopeMins, scopeMaxs, spectrumDecibels;
 
 	void checkShaderCompileSuccess(int shader);
 	void checkProgramLinkSuccess(int program);
+	void looperControls(Engine *engine);
+	void drawFlameStrip(ImDrawList *drawList, ImVec2 origin, ImVec2 size);
+	void drawTakeEvents(ImDrawList *drawList, ImVec2 origin,
+			float pixelsPerSecond, float rowHeight, int highestPitch);
+	bool drawTakeDensity(ImDrawList *drawList, const Take *take, ImVec2 origin,
+			float pixelsPerSecond, float rowHeight, int lowestPitch,
+			int highestPitch, int level);
 public:
-	GLuint fontTexture;
+	// also holds the glyphs of the key labels, which SFML draws from it
+	sf::Texture fontTexture;
 	int shaderHandle, vertHandle, fragHandle;
 	int attribLocationTex, attribLocationProjMtx;
 	int attribLocationPosition, attribLocationUV, attribLocationColor;
 	unsigned int vboHandle, vaoHandle, elementsHandle;
+	size_t vboCapacity, elementsCapacity;
+	std::vector<ImDrawVert> stagingVertices;
+	std::vector<GLuint> stagingIndices;
 
-	bool waveOpen, settingsOpen;
+	bool waveOpen, settingsOpen, pianoRollOpen, performanceOpen;
+	bool expandHeaders;
 
 	int mousePosX;
 	int mousePosY;
@@ -28,11 +66,19 @@ public:
 	Gui();
 	~Gui();
 
-	void MainMenuBar();
+	void MainMenuBar(Engine *engine);
 	void TabBar();
+	void SelectTab(GlobalsHolder::Tab tab);
 	bool BeginSettingsWindow();
+	bool SettingsHeader(const char *label);
 	void WaveWindow(bool *shouldCompile);
 	void WaveWindowFileOps();
+	void PianoRollWindow(Take *take, double now);
+	void PerformanceWindow();
+	void OutputScope(Scope *scope);
+	void SetPreviews(const std::vector<Note> &notes,
+			const std::vector<WaveSummary> &summaries);
+	void NotePreviews(int samplesInPreview);
 	void CreateFontTexture(ImFont *imFont);
 	void Update(int dt);
 	void Draw();
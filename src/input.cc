@@ -0,0 +1,227 @@
+#include "input.hh"
+#include "constants.hh"
+#include "profiler.hh"
+
+Input::Input(Keyboard *nKeyboard, Engine *nEngine, Gui *nGui, Take *nTake,
+		MidiInput *nMidi, const sf::Clock *nClock)
+{
+	keyboard = nKeyboard;
+	engine = nEngine;
+	gui = nGui;
+	take = nTake;
+	midi = nMidi;
+	clock = nClock;
+	quit = false;
+	closed = false;
+	measuring = false;
+	pendingWheel = 0;
+	takeOffset = 0;
+	writing = false;
+}
+
+Input::~Input()
+{
+	Stop();
+}
+
+void Input::Start(const Source &nSource, bool measureLatency)
+{
+	Stop();
+	source = nSource;
+	measuring = measureLatency;
+	quit = false;
+	reader = std::thread(&Input::run, this);
+}
+
+void Input::Stop()
+{
+	if (!reader.joinable())
+		return;
+	quit = true;
+	reader.join();
+}
+
+bool Input::Closed() const
+{
+	return closed;
+}
+
+std::vector<double> Input::TakeLatencies()
+{
+	std::vector<double> taken;
+	std::lock_guard<std::mutex> lock(eventsMutex);
+	taken.swap(latencies);
+	return taken;
+}
+
+void Input::run()
+{
+	profiler::SetThreadName("input");
+	const sf::Time idle = sf::microseconds(Constants.input.pollMicroseconds);
+	Event event;
+	while (!quit) {
+		bool any = false;
+		while (source(&event)) {
+			handle(event);
+			any = true;
+		}
+		// SFML has nothing to wait on, poll again shortly
+		if (!any)
+			sf::sleep(idle);
+	}
+}
+
+// on the input thread: notes go to the engine now, the rest waits for Poll()
+void Input::handle(const Event &event)
+{
+	profiler::Zone zone(profiler::Zone_PollEvents);
+	if (event.event.type == sf::Event::Closed)
+		closed = true;
+	Key *key = nullptr;
+	if ((event.event.type == sf::Event::KeyPressed ||
+				event.event.type == sf::Event::KeyReleased) &&
+			Globals.playingOnKeys)
+		key = keyboard->Lookup(event.event.key.code);
+	if (key && event.event.type == sf::Event::KeyPressed)
+		key->KeyPressed(engine, event.stamp);
+	else if (key)
+		key->KeyReleased(engine, event.stamp);
+
+	std::lock_guard<std::mutex> lock(eventsMutex);
+	if (key && measuring)
+		latencies.push_back(
+				(clock->getElapsedTime() - event.stamp).asMicroseconds());
+	events.push_back(event);
+}
+
+bool Input::Poll()
+{
+	{
+		std::lock_guard<std::mutex> lock(eventsMutex);
+		polled.swap(events);
+	}
+	const bool any = !polled.empty();
+	for (auto &event : polled) {
+		switch (event.event.type) {
+			case sf::Event::KeyPressed:
+				keyPressed(event);
+				break;
+			case sf::Event::KeyReleased:
+				keyReleased(event);
+				break;
+			case sf::Event::TextEntered:
+				if (event.event.text.unicode > 0 &&
+						event.event.text.unicode < 0x10000)
+					pendingCharacters.push_back(event.event.text.unicode);
+				break;
+			case sf::Event::MouseButtonPressed:
+				gui->mousePressed[event.event.mouseButton.button] = true;
+				break;
+			case sf::Event::MouseButtonReleased:
+				gui->mousePressed[event.event.mouseButton.button] = false;
+				break;
+			case sf::Event::MouseWheelMoved:
+				pendingWheel += (float)event.event.mouseWheel.delta;
+				break;
+			case sf::Event::MouseMoved:
+				gui->mousePosX = event.event.mouseMove.x;
+				gui->mousePosY = event.event.mouseMove.y;
+				break;
+			default:
+				break;
+		}
+	}
+	polled.clear();
+	return midiNotes() || any;
+}
+
+bool Input::midiNotes()
+{
+	if (!midi)
+		return false;
+	midi->Collect(&midiEvents);
+	const bool any = !midiEvents.empty();
+	for (auto &event : midiEvents) {
+		Key *key = keyboard->LookupPitch(event.pitch);
+		if (!key)
+			continue;
+		key->keyPressed = event.on;
+		key->played |= event.on;
+		if (!writing)
+			continue;
+		if (event.on)
+			take->NoteOn(event.pitch, TakeTime(event.stamp));
+		else
+			take->NoteOff(event.pitch, TakeTime(event.stamp));
+	}
+	midiEvents.clear();
+	return any;
+}
+
+// the engine has had the note since handle(), this only shows and records it
+void Input::keyPressed(const Event &event)
+{
+	ImGuiIO& io = ImGui::GetIO();
+	if (event.event.key.code >= 0)
+		io.KeysDown[event.event.key.code] = true;
+	io.KeyCtrl = event.event.key.control;
+	io.KeyShift = event.event.key.shift;
+
+	if (!Globals.playingOnKeys)
+		return;
+	if (Key *key = keyboard->Lookup(event.event.key.code)) {
+		key->keyPressed = true;
+		key->played = true;
+		if (writing)
+			take->NoteOn(key->note.Pitch(), TakeTime(event.stamp));
+	}
+}
+
+void Input::keyReleased(const Event &event)
+{
+	ImGuiIO& io = ImGui::GetIO();
+	if (event.event.key.code >= 0)
+		io.KeysDown[event.event.key.code] = false;
+	io.KeyCtrl = event.event.key.control;
+	io.KeyShift = event.event.key.shift;
+
+	if (!Globals.playingOnKeys)
+		return;
+	if (Key *key = keyboard->Lookup(event.event.key.code)) {
+		key->keyPressed = false;
+		if (writing)
+			take->NoteOff(key->note.Pitch(), TakeTime(event.stamp));
+	}
+}
+
+void Input::FlushToGui()
+{
+	ImGuiIO& io = ImGui::GetIO();
+	for (auto c : pendingCharacters)
+		io.AddInputCharacter(c);
+	pendingCharacters.clear();
+	io.MouseWheel += pendingWheel;
+	pendingWheel = 0;
+}
+
+void Input::UpdateMode(sf::Time now)
+{
+	if (Globals.mode == GlobalsHolder::Mode_Writing && !writing) {
+		takeOffset = now.asSeconds() - take->GetLength();
+		writing = true;
+	} else if (Globals.mode != GlobalsHolder::Mode_Writing && writing) {
+		take->CloseOpenNotes(TakeTime(now));
+		writing = false;
+	}
+}
+
+bool Input::IsWriting() const
+{
+	return writing;
+}
+
+double Input::TakeTime(sf::Time now) const
+{
+	return now.asSeconds() - takeOffset;
+}
+
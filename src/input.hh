@@ -0,0 +1,90 @@
+#ifndef INPUT_HH
+#define INPUT_HH
+
+#include "engine.hh"
+#include "gui.hh"
+#include "keyboard.hh"
+#include "midi.hh"
+#include "take.hh"
+
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Reads window events on a thread of its own, the way MidiInput reads the
+// sequencer, so that how long a frame takes never holds a note back: each
+// event is stamped when it arrives and key events go to the engine right
+// there, through the key bound to them. The main thread sees the events
+// afterwards through Poll(), for ImGui, drawing and recording; what ImGui
+// only reads once per frame (typed characters, the mouse wheel) is held
+// back until FlushToGui().
+// Events come from a Source, the window in the main loop and a queue of
+// scripted events in --headless-bench; SFML on X11 may be polled off the
+// thread that made the window as long as XInitThreads() ran first.
+// MIDI notes have already reached the engine by the time they are seen
+// here, Poll() only shows and records them.
+// Poll() tells whether anything came in, so that idle frames can be
+// skipped.
+class Input
+{
+public:
+	struct Event {
+		sf::Event event;
+		sf::Time stamp;
+	};
+	// fills in the next event that arrived and returns true, or returns
+	// false when there is none yet
+	typedef std::function<bool(Event*)> Source;
+private:
+	Keyboard *keyboard;
+	Engine *engine;
+	Gui *gui;
+	Take *take;
+	MidiInput *midi;
+	const sf::Clock *clock;
+	std::vector<MidiInput::Event> midiEvents;
+
+	Source source;
+	std::thread reader;
+	std::atomic<bool> quit, closed;
+	bool measuring;
+
+	std::mutex eventsMutex;
+	std::vector<Event> events, polled;
+	// microseconds from arrival to the engine, while measuring
+	std::vector<double> latencies;
+
+	std::vector<ImWchar> pendingCharacters;
+	float pendingWheel;
+
+	// take time only advances while in Writing mode
+	double takeOffset;
+	bool writing;
+
+	void run();
+	void handle(const Event &event);
+	void keyPressed(const Event &event);
+	void keyReleased(const Event &event);
+	bool midiNotes();
+public:
+	Input(Keyboard *nKeyboard, Engine *nEngine, Gui *nGui, Take *nTake,
+			MidiInput *nMidi, const sf::Clock *nClock);
+	~Input();
+
+	void Start(const Source &nSource, bool measureLatency = false);
+	void Stop();
+	bool Closed() const;
+	std::vector<double> TakeLatencies();
+
+	bool Poll();
+	void FlushToGui();
+
+	void UpdateMode(sf::Time now);
+	bool IsWriting() const;
+	double TakeTime(sf::Time now) const;
+};
+
+#endif
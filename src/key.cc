@@ -4,42 +4,40 @@
 #include "conv.hh"
 #include "note_atlas.hh"
 
-Key::Key()
+#include <algorithm>
+
+static void appendQuad(sf::VertexArray *array, sf::FloatRect rect,
+		sf::Color color, sf::FloatRect texRect = sf::FloatRect())
 {
-	rectangleShape.setSize(sf::Vector2f(
-				Constants.rectangle.size, Constants.rectangle.size));
-	rectangleShape.setOutlineThickness(Constants.rectangle.outline);
+	const float right = rect.left + rect.width, bottom = rect.top + rect.height;
+	const float texRight = texRect.left + texRect.width,
+		texBottom = texRect.top + texRect.height;
+	array->append(sf::Vertex(sf::Vector2f(rect.left, rect.top), color,
+				sf::Vector2f(texRect.left, texRect.top)));
+	array->append(sf::Vertex(sf::Vector2f(right, rect.top), color,
+				sf::Vector2f(texRight, texRect.top)));
+	array->append(sf::Vertex(sf::Vector2f(right, bottom), color,
+				sf::Vector2f(texRight, texBottom)));
+	array->append(sf::Vertex(sf::Vector2f(rect.left, bottom), color,
+				sf::Vector2f(texRect.left, texBottom)));
+}
 
-	// lineShape.setSize(sf::Vector2f(
-	// 			Constants.line.thickness,
-	// 			Globals.windowHeight - Constants.padding*2));
-	// lineShape.setFillColor(Constants.line.color);
-	keyPressed = false;
+static sf::FloatRect grow(sf::FloatRect rect, float by)
+{
+	return sf::FloatRect(rect.left - by, rect.top - by,
+			rect.width + 2*by, rect.height + 2*by);
 }
 
-void Key::CreateSprites()
+Key::Key()
 {
-	sf::IntRect rect = note_atlas::LookupNotePosition(note.letter,
-				note.accidental, note.octave);
-	textSprite.setSize(sf::Vector2f(rect.width, rect.height));
-	textSprite.setTextureRect(rect);
-	textSprite.setOutlineThickness(Constants.text.outline);
-	textSprite.setOutlineColor(conv::HSVtoRGB(0, 0, Constants.text.backgroundValue));
-	textSprite.setPosition(
-			rectangleShape.getPosition().x +
-			rectangleShape.getLocalBounds().width/2 -
-			textSprite.getLocalBounds().width/2 +
-			Constants.text.outline,
-			rectangleShape.getPosition().y +
-			rectangleShape.getLocalBounds().height/2 -
-			textSprite.getLocalBounds().height/2 +
-			Constants.text.outline);
+	keyPressed = false;
+	played = false;
+	voice = 0;
 }
 
 void Key::SetPosition(int x, int y)
 {
-	rectangleShape.setPosition(x, y);
-	// lineShape.setPosition(x + Constants.rectangle.size/2, Constants.padding);
+	position = sf::Vector2f(x, y);
 }
 
 void Key::SetHue(int h)
@@ -55,36 +53,51 @@ void Key::SetHue(int h)
 	pressedOutlineColor = conv::HSVtoRGB(h, pressedSaturation, outlineValue);
 }
 
-void Key::SetTexture(sf::Texture *texture)
+// Same geometry sf::RectangleShape used to produce: a negative outline
+// goes inside the rectangle, a positive one outside. The label is centered
+// on the key with a plain border around it.
+void Key::AppendVertices(sf::VertexArray *shapes, sf::VertexArray *labels) const
 {
-	textSprite.setTexture(texture);
-}
-
-void Key::Draw(sf::RenderWindow *window)
-{
-	// window->draw(lineShape);
+	const float size = Constants.rectangle.size,
+		outline = Constants.rectangle.outline;
+	const sf::FloatRect body(position.x, position.y, size, size);
+	appendQuad(shapes, grow(body, std::max(outline, 0.f)), outlineColor);
+	appendQuad(shapes, grow(body, std::min(outline, 0.f)), color);
 
-	if (keyPressed) {
-		rectangleShape.setFillColor(pressedColor);
-		rectangleShape.setOutlineColor(pressedOutlineColor);
-	} else {
-		rectangleShape.setFillColor(color);
-		rectangleShape.setOutlineColor(outlineColor);
+	const note_atlas::Label noteLabel = note_atlas::LookupLabel(note.name,
+			note.octave);
+	const sf::Vector2f labelPosition(
+			(int)(position.x + size/2 - noteLabel.size.x/2),
+			(int)(position.y + size/2 - noteLabel.size.y/2));
+	appendQuad(shapes, grow(sf::FloatRect(labelPosition.x, labelPosition.y,
+					noteLabel.size.x, noteLabel.size.y), Constants.text.outline),
+			conv::HSVtoRGB(0, 0, Constants.text.backgroundValue));
+	const sf::Color textColor = conv::HSVtoRGB(0, 0, Constants.text.colorValue);
+	for (int i = 0; i < noteLabel.glyphCount; i++) {
+		sf::FloatRect quad = noteLabel.quads[i];
+		quad.left += labelPosition.x;
+		quad.top += labelPosition.y;
+		appendQuad(labels, quad, textColor, noteLabel.texRects[i]);
 	}
+}
 
-	window->draw(rectangleShape);
-
-	window->draw(textSprite);
+void Key::UpdateColors(sf::Vertex *vertices, bool pressed) const
+{
+	const sf::Color outlines = pressed ? pressedOutlineColor : outlineColor,
+		fill = pressed ? pressedColor : color;
+	for (int i = 0; i < 4; i++)
+		vertices[i].color = outlines;
+	for (int i = 4; i < colouredVertices; i++)
+		vertices[i].color = fill;
 }
 
-void Key::KeyPressed()
+void Key::KeyPressed(Engine *engine, sf::Time stamp)
 {
-	note.sound.setLoop(true);
-	note.sound.play();
+	engine->NoteOn(voice, stamp);
 }
 
-void Key::KeyReleased()
+void Key::KeyReleased(Engine *engine, sf::Time stamp)
 {
-	note.sound.setLoop(false);
+	engine->NoteOff(voice, stamp);
 }
 
@@ -2,36 +2,43 @@
 #define KEY_HH
 
 #include "conv.hh"
+#include "engine.hh"
 #include "note.hh"
 
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <string>
 
+// A key doesn't draw itself, it adds its quads to the vertex arrays of
+// the keyboard and recolours them when it gets pressed or released.
 class Key
 {
-	sf::RectangleShape rectangleShape;
-	// sf::RectangleShape lineShape;
+	sf::Vector2f position;
 	sf::Color
 		color, outlineColor,
 		pressedColor, pressedOutlineColor;
-	sf::RectangleShape textSprite;
 
 public:
+	// the key occupies this many vertices in the shapes array, the first
+	// colouredVertices of them change colour when pressed
+	static const int shapeVertices = 12, colouredVertices = 8;
+
 	sf::Keyboard::Key key;
 	bool keyPressed;
+	// since the main loop last looked, for SampleCache
+	bool played;
+	int voice;
 
 	Note note;
 
 	Key();
-	void CreateSprites();
 	void SetPosition(int x, int y);
 	void SetHue(int h);
-	void SetTexture(sf::Texture *texture);
-	void Draw(sf::RenderWindow *window);
+	void AppendVertices(sf::VertexArray *shapes, sf::VertexArray *labels) const;
+	void UpdateColors(sf::Vertex *vertices, bool pressed) const;
 
-	void KeyPressed();
-	void KeyReleased();
+	void KeyPressed(Engine *engine, sf::Time stamp);
+	void KeyReleased(Engine *engine, sf::Time stamp);
 };
 
 #endif
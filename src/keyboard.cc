@@ -0,0 +1,353 @@
+#include "keyboard.hh"
+#include "constants.hh"
+#include "profiler.hh"
+
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+static const struct {
+	const char *name;
+	sf::Keyboard::Key code;
+} keyNames[] = {
+	{ "A", sf::Keyboard::A }, { "B", sf::Keyboard::B },
+	{ "C", sf::Keyboard::C }, { "D", sf::Keyboard::D },
+	{ "E", sf::Keyboard::E }, { "F", sf::Keyboard::F },
+	{ "G", sf::Keyboard::G }, { "H", sf::Keyboard::H },
+	{ "I", sf::Keyboard::I }, { "J", sf::Keyboard::J },
+	{ "K", sf::Keyboard::K }, { "L", sf::Keyboard::L },
+	{ "M", sf::Keyboard::M }, { "N", sf::Keyboard::N },
+	{ "O", sf::Keyboard::O }, { "P", sf::Keyboard::P },
+	{ "Q", sf::Keyboard::Q }, { "R", sf::Keyboard::R },
+	{ "S", sf::Keyboard::S }, { "T", sf::Keyboard::T },
+	{ "U", sf::Keyboard::U }, { "V", sf::Keyboard::V },
+	{ "W", sf::Keyboard::W }, { "X", sf::Keyboard::X },
+	{ "Y", sf::Keyboard::Y }, { "Z", sf::Keyboard::Z },
+	{ "Num0", sf::Keyboard::Num0 }, { "Num1", sf::Keyboard::Num1 },
+	{ "Num2", sf::Keyboard::Num2 }, { "Num3", sf::Keyboard::Num3 },
+	{ "Num4", sf::Keyboard::Num4 }, { "Num5", sf::Keyboard::Num5 },
+	{ "Num6", sf::Keyboard::Num6 }, { "Num7", sf::Keyboard::Num7 },
+	{ "Num8", sf::Keyboard::Num8 }, { "Num9", sf::Keyboard::Num9 },
+	{ "LBracket", sf::Keyboard::LBracket },
+	{ "RBracket", sf::Keyboard::RBracket },
+	{ "SemiColon", sf::Keyboard::SemiColon },
+	{ "Comma", sf::Keyboard::Comma },
+	{ "Period", sf::Keyboard::Period },
+	{ "Quote", sf::Keyboard::Quote },
+	{ "Slash", sf::Keyboard::Slash },
+	{ "BackSlash", sf::Keyboard::BackSlash },
+	{ "Tilde", sf::Keyboard::Tilde },
+	{ "Equal", sf::Keyboard::Equal },
+	{ "Dash", sf::Keyboard::Dash },
+	{ "Space", sf::Keyboard::Space },
+	{ "Return", sf::Keyboard::Return },
+	{ "BackSpace", sf::Keyboard::BackSpace },
+	{ "Tab", sf::Keyboard::Tab },
+	{ "PageUp", sf::Keyboard::PageUp },
+	{ "PageDown", sf::Keyboard::PageDown },
+	{ "End", sf::Keyboard::End },
+	{ "Home", sf::Keyboard::Home },
+	{ "Insert", sf::Keyboard::Insert },
+	{ "Delete", sf::Keyboard::Delete },
+	{ "Add", sf::Keyboard::Add },
+	{ "Subtract", sf::Keyboard::Subtract },
+	{ "Multiply", sf::Keyboard::Multiply },
+	{ "Divide", sf::Keyboard::Divide },
+	{ "Left", sf::Keyboard::Left }, { "Right", sf::Keyboard::Right },
+	{ "Up", sf::Keyboard::Up }, { "Down", sf::Keyboard::Down },
+	{ "Numpad0", sf::Keyboard::Numpad0 }, { "Numpad1", sf::Keyboard::Numpad1 },
+	{ "Numpad2", sf::Keyboard::Numpad2 }, { "Numpad3", sf::Keyboard::Numpad3 },
+	{ "Numpad4", sf::Keyboard::Numpad4 }, { "Numpad5", sf::Keyboard::Numpad5 },
+	{ "Numpad6", sf::Keyboard::Numpad6 }, { "Numpad7", sf::Keyboard::Numpad7 },
+	{ "Numpad8", sf::Keyboard::Numpad8 }, { "Numpad9", sf::Keyboard::Numpad9 },
+	{ "F1", sf::Keyboard::F1 }, { "F2", sf::Keyboard::F2 },
+	{ "F3", sf::Keyboard::F3 }, { "F4", sf::Keyboard::F4 },
+	{ "F5", sf::Keyboard::F5 }, { "F6", sf::Keyboard::F6 },
+	{ "F7", sf::Keyboard::F7 }, { "F8", sf::Keyboard::F8 },
+	{ "F9", sf::Keyboard::F9 }, { "F10", sf::Keyboard::F10 },
+	{ "F11", sf::Keyboard::F11 }, { "F12", sf::Keyboard::F12 },
+	{ "F13", sf::Keyboard::F13 }, { "F14", sf::Keyboard::F14 },
+	{ "F15", sf::Keyboard::F15 },
+	{ "Pause", sf::Keyboard::Pause },
+	{ "-", sf::Keyboard::Unknown },
+};
+
+Keyboard::Keyboard()
+	: shapes(sf::Quads), labels(sf::Quads)
+{
+	rows = 0;
+	atlas = nullptr;
+	for (int i = 0; i < sf::Keyboard::KeyCount; i++)
+		table[i] = -1;
+	for (int i = 0; i < 128; i++)
+		pitchTable[i] = -1;
+}
+
+bool Keyboard::LoadLayout(const char *filename)
+{
+	profiler::Zone zone(profiler::Zone_DiskIo);
+	FILE *f = fopen(filename, "rb");
+	if (!f) {
+		printf("Failed to open layout \"%s\", using the built-in one\n",
+				filename);
+		return parseLayout(Constants.defaultLayout, "built-in");
+	}
+	fseek(f, 0, SEEK_END);
+	size_t fileSize = ftell(f);
+	rewind(f);
+	std::string layout(fileSize, '\0');
+	if (fread(&layout[0], 1, fileSize, f) != fileSize) {
+		printf("Failed to read layout \"%s\"\n", filename);
+		fclose(f);
+		return false;
+	}
+	fclose(f);
+	return parseLayout(layout, filename);
+}
+
+bool Keyboard::parseLayout(const std::string &layout, const char *name)
+{
+	std::istringstream lines(layout);
+	std::string line;
+	int lineNumber = 0;
+	keys.clear();
+	rows = 0;
+	int low = -1, high = -1;
+	while (std::getline(lines, line)) {
+		lineNumber++;
+		std::istringstream tokens(line);
+		std::string token;
+		if (!(tokens >> token) || token[0] == '#')
+			continue;
+		if (token == "range") {
+			if (!parseRange(tokens, name, lineNumber, &low, &high))
+				return false;
+			continue;
+		}
+
+		char *end;
+		const int octave = strtol(token.c_str(), &end, 10);
+		if (*end != '\0') {
+			printf("Layout \"%s\", line %d: expected octave, got \"%s\"\n",
+					name, lineNumber, token.c_str());
+			return false;
+		}
+
+		for (int n = 0; n < 12; n++) {
+			if (!(tokens >> token)) {
+				printf("Layout \"%s\", line %d: expected 12 keys\n",
+						name, lineNumber);
+				return false;
+			}
+			size_t k = 0;
+			const size_t keyNameCount = sizeof(keyNames)/sizeof(keyNames[0]);
+			while (k < keyNameCount && token != keyNames[k].name)
+				k++;
+			if (k == keyNameCount) {
+				printf("Layout \"%s\", line %d: unknown key \"%s\"\n",
+						name, lineNumber, token.c_str());
+				return false;
+			}
+			Key key;
+			key.key = keyNames[k].code;
+			key.note = Note((note::Name)n, octave);
+			keys.push_back(key);
+		}
+		rows++;
+	}
+	if (rows == 0) {
+		printf("Layout \"%s\" has no keys\n", name);
+		return false;
+	}
+
+	std::vector<bool> covered(128, false);
+	for (auto &key : keys) {
+		const int pitch = key.note.Pitch();
+		if (pitch >= 0 && pitch < 128)
+			covered[pitch] = true;
+	}
+	for (int pitch = low; pitch >= 0 && pitch <= high; pitch++) {
+		if (covered[pitch])
+			continue;
+		Key key;
+		key.key = sf::Keyboard::Unknown;
+		key.note = Note((note::Name)(pitch % 12), pitch/12 - 1);
+		keys.push_back(key);
+	}
+	buildTables(name);
+	return true;
+}
+
+void Keyboard::buildTables(const char *name)
+{
+	for (int i = 0; i < sf::Keyboard::KeyCount; i++)
+		table[i] = -1;
+	for (size_t i = 0; i < keys.size(); i++) {
+		keys[i].voice = i;
+		if (keys[i].key == sf::Keyboard::Unknown)
+			continue;
+		if (table[keys[i].key] != -1)
+			printf("Layout \"%s\": key assigned twice, keeping the last one\n",
+					name);
+		table[keys[i].key] = i;
+	}
+	for (int i = 0; i < 128; i++)
+		pitchTable[i] = -1;
+	for (size_t i = 0; i < keys.size(); i++) {
+		const int pitch = keys[i].note.Pitch();
+		if (pitch >= 0 && pitch < 128 && pitchTable[pitch] == -1)
+			pitchTable[pitch] = i;
+	}
+}
+
+std::vector<Keyboard::Mapping> Keyboard::GetMappings() const
+{
+	std::vector<Mapping> mappings;
+	for (auto &key : keys)
+		mappings.push_back({ key.key, key.note.name, key.note.octave });
+	return mappings;
+}
+
+bool Keyboard::SetMappings(int nRows, const Mapping *mappings, size_t count)
+{
+	if (nRows <= 0 || (size_t)nRows*12 > count)
+		return false;
+	for (size_t i = 0; i < count; i++)
+		if (mappings[i].key < sf::Keyboard::Unknown ||
+				mappings[i].key >= sf::Keyboard::KeyCount ||
+				mappings[i].name < note::C || mappings[i].name > note::B)
+			return false;
+	keys.clear();
+	for (size_t i = 0; i < count; i++) {
+		Key key;
+		key.key = (sf::Keyboard::Key)mappings[i].key;
+		key.note = Note((note::Name)mappings[i].name, mappings[i].octave);
+		keys.push_back(key);
+	}
+	rows = nRows;
+	buildTables("session");
+	return true;
+}
+
+// "range <lowest> <highest>", both as in C#4, A0
+bool Keyboard::parseRange(std::istringstream &tokens, const char *name,
+		int lineNumber, int *low, int *high)
+{
+	static const int letterNames[7] = {
+		note::A, note::B, note::C, note::D, note::E, note::F, note::G
+	};
+	int *ends[2] = { low, high };
+	for (int *end : ends) {
+		std::string token;
+		if (!(tokens >> token) || token[0] < 'A' || token[0] > 'G') {
+			printf("Layout \"%s\", line %d: expected \"range <note> <note>\"\n",
+					name, lineNumber);
+			return false;
+		}
+		const char *rest = token.c_str() + 1;
+		int pitch = letterNames[token[0] - 'A'];
+		if (*rest == '#') {
+			pitch++;
+			rest++;
+		}
+		char *octaveEnd;
+		const int octave = strtol(rest, &octaveEnd, 10);
+		pitch += (octave + 1)*12;
+		if (octaveEnd == rest || *octaveEnd != '\0' || pitch < 0 || pitch > 127) {
+			printf("Layout \"%s\", line %d: \"%s\" is not a MIDI note\n",
+					name, lineNumber, token.c_str());
+			return false;
+		}
+		*end = pitch;
+	}
+	if (*low > *high) {
+		printf("Layout \"%s\", line %d: range goes downwards\n",
+				name, lineNumber);
+		return false;
+	}
+	return true;
+}
+
+void Keyboard::Place(sf::Texture *fontAtlas)
+{
+	atlas = fontAtlas;
+	const size_t onScreen = KeysOnScreen();
+	int hue = 0;
+	for (int r = 0; r < rows; r++)
+		for (int i = 11; i >= 0; i--) {
+			Key &key = keys[r*12 + i];
+			key.SetHue((hue++/(double)onScreen)*360);
+			int x = Constants.padding + i*(Constants.rectangle.size + Constants.padding);
+			int y = Globals.windowHeight - Constants.padding - Constants.rectangle.size -
+				(rows-r-1)*(Constants.rectangle.size + Constants.padding);
+			key.SetPosition(x, y);
+		}
+
+	shapes.clear();
+	labels.clear();
+	for (size_t i = 0; i < onScreen; i++)
+		keys[i].AppendVertices(&shapes, &labels);
+	drawnPressed.assign(onScreen, false);
+}
+
+size_t Keyboard::KeysOnScreen() const
+{
+	return rows*12;
+}
+
+Key* Keyboard::Lookup(sf::Keyboard::Key code)
+{
+	if (code < 0 || code >= sf::Keyboard::KeyCount || table[code] == -1)
+		return nullptr;
+	return &keys[table[code]];
+}
+
+Key* Keyboard::LookupPitch(int pitch)
+{
+	if (pitch < 0 || pitch >= 128 || pitchTable[pitch] == -1)
+		return nullptr;
+	return &keys[pitchTable[pitch]];
+}
+
+Key* Keyboard::LookupName(const char *name)
+{
+	for (auto &keyName : keyNames)
+		if (!strcmp(keyName.name, name))
+			return keyName.code == sf::Keyboard::Unknown ? nullptr :
+				Lookup(keyName.code);
+	return nullptr;
+}
+
+std::vector<Note> Keyboard::Notes() const
+{
+	std::vector<Note> notes;
+	for (auto &key : keys)
+		notes.push_back(key.note);
+	return notes;
+}
+
+void Keyboard::SetSamples(const std::vector<Samples> &samples)
+{
+	for (size_t i = 0; i < keys.size() && i < samples.size(); i++)
+		keys[i].note.samples = samples[i];
+}
+
+void Keyboard::SetSamples(int voice, const Samples &samples)
+{
+	if (voice >= 0 && voice < (int)keys.size())
+		keys[voice].note.samples = samples;
+}
+
+void Keyboard::Draw(sf::RenderTarget *target)
+{
+	profiler::Zone zone(profiler::Zone_KeyboardDraw);
+	for (size_t i = 0; i < drawnPressed.size(); i++) {
+		if (keys[i].keyPressed == drawnPressed[i])
+			continue;
+		keys[i].UpdateColors(&shapes[i*Key::shapeVertices], keys[i].keyPressed);
+		drawnPressed[i] = keys[i].keyPressed;
+	}
+	target->draw(shapes);
+	target->draw(labels, sf::RenderStates(atlas));
+}
+
@@ -0,0 +1,66 @@
+#ifndef KEYBOARD_HH
+#define KEYBOARD_HH
+
+#include "engine.hh"
+#include "key.hh"
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// All the playable keys. Which keyboard key plays which note is read from
+// a layout file, see layouts/qwerty.layout for the format. Key codes are
+// resolved through a table indexed by sf::Keyboard::Key, so dispatching an
+// event doesn't depend on the amount of keys. MIDI notes are resolved the
+// same way, through a table indexed by pitch.
+// A "range" line widens the notes past the rows, every pitch in it that no
+// row covers gets a key of its own that only MIDI plays. Those come after
+// the keys of the rows and aren't drawn.
+// The whole keyboard is kept in two vertex arrays, one for the coloured
+// quads and one for the labels, and drawn with one call each.
+class Keyboard
+{
+	int rows;
+	int table[sf::Keyboard::KeyCount];
+	int pitchTable[128];
+
+	sf::Texture *atlas;
+	sf::VertexArray shapes, labels;
+	std::vector<bool> drawnPressed;
+
+	bool parseLayout(const std::string &layout, const char *name);
+	bool parseRange(std::istringstream &tokens, const char *name,
+			int lineNumber, int *low, int *high);
+	void buildTables(const char *name);
+public:
+	// what a layout comes down to, one per key, as saved in sessions
+	struct Mapping {
+		int32_t key, name, octave;
+	};
+
+	std::vector<Key> keys;
+
+	Keyboard();
+
+	bool LoadLayout(const char *filename);
+	void Place(sf::Texture *fontAtlas);
+	// the keys of the rows, the first ones in keys
+	size_t KeysOnScreen() const;
+	Key* Lookup(sf::Keyboard::Key code);
+	Key* LookupPitch(int pitch);
+	// by the name of its keyboard key, as in layout files
+	Key* LookupName(const char *name);
+	std::vector<Mapping> GetMappings() const;
+	// keys as they were, rows first; false if they don't make sense
+	bool SetMappings(int nRows, const Mapping *mappings, size_t count);
+
+	std::vector<Note> Notes() const;
+	void SetSamples(const std::vector<Samples> &samples);
+	void SetSamples(int voice, const Samples &samples);
+	void Draw(sf::RenderTarget *target);
+};
+
+#endif
+
@@ -0,0 +1,127 @@
+#include "looper.hh"
+#include "constants.hh"
+
+Looper::Looper()
+{
+	buffer.resize(Constants.looper.maxSeconds*Constants.samplesPerSecond);
+	position = 0;
+	length = 0;
+	passHadInput = false;
+	state = State_Empty;
+	layers = 0;
+	publishedPosition = 0;
+	publishedLength = 0;
+}
+
+void Looper::Perform(Action action)
+{
+	switch (action) {
+		case Action_Record:
+			// the first pass overwrites whatever was in the buffer, so
+			// there is no need to clear it here
+			position = 0;
+			length = 0;
+			layers = 0;
+			state = State_Recording;
+			break;
+		case Action_CloseLoop:
+			if (state != State_Recording)
+				break;
+			length = position;
+			position = 0;
+			if (length == 0) {
+				state = State_Empty;
+				break;
+			}
+			layers = 1;
+			passHadInput = false;
+			state = State_Overdubbing;
+			break;
+		case Action_Stop:
+			if (state == State_Recording)
+				Perform(Action_CloseLoop);
+			if (state == State_Overdubbing || state == State_Playing)
+				state = State_Stopped;
+			break;
+		case Action_Play:
+			if (state == State_Stopped)
+				state = State_Playing;
+			break;
+		case Action_Overdub:
+			if (state == State_Playing) {
+				passHadInput = false;
+				state = State_Overdubbing;
+			} else if (state == State_Overdubbing) {
+				// a pass left halfway still made a layer
+				if (passHadInput)
+					layers++;
+				state = State_Playing;
+			}
+			break;
+		case Action_Clear:
+			position = 0;
+			length = 0;
+			layers = 0;
+			state = State_Empty;
+			break;
+	}
+	publish();
+}
+
+// `block' holds the live layer on input and the complete mix on output
+void Looper::Process(float *block, size_t count, bool liveInput)
+{
+	size_t i = 0;
+	if (state == State_Recording) {
+		for (; i < count && position < buffer.size(); i++)
+			buffer[position++] = block[i];
+		// a full buffer closes the loop, the rest of the block goes into
+		// its first overdub
+		if (position == buffer.size())
+			Perform(Action_CloseLoop);
+	}
+	if (state == State_Overdubbing || state == State_Playing) {
+		const bool overdubbing = state == State_Overdubbing;
+		passHadInput |= overdubbing && liveInput;
+		for (; i < count; i++) {
+			const float bounced = buffer[position];
+			if (overdubbing)
+				buffer[position] = bounced + block[i];
+			block[i] += bounced;
+			if (++position == length) {
+				position = 0;
+				if (passHadInput)
+					layers++;
+				passHadInput = overdubbing && liveInput;
+			}
+		}
+	}
+	publish();
+}
+
+void Looper::publish()
+{
+	publishedPosition = position;
+	publishedLength = state == State_Recording ? position : length;
+}
+
+Looper::State Looper::GetState() const
+{
+	return (State)state.load();
+}
+
+int Looper::GetLayers() const
+{
+	return layers;
+}
+
+size_t Looper::GetPosition() const
+{
+	return publishedPosition;
+}
+
+size_t Looper::GetLength() const
+{
+	return publishedLength;
+}
+
@@ -0,0 +1,55 @@
+#ifndef LOOPER_HH
+#define LOOPER_HH
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Overdub looper. Everything that was played on previous passes lives in
+// a single pre-mixed float buffer, so only the layer being recorded right
+// now is synthesised live and the cost per block doesn't depend on the
+// amount of layers. Once a loop is closed it is either overdubbed, with
+// whatever is played mixed into it, or just played back.
+// All methods except the getters are called from the audio thread only.
+class Looper
+{
+	std::vector<float> buffer;
+	size_t position, length;
+	bool passHadInput;
+
+	std::atomic<int> state;
+	std::atomic<int> layers;
+	std::atomic<size_t> publishedPosition, publishedLength;
+
+	void publish();
+public:
+	enum State {
+		State_Empty,
+		State_Recording,
+		State_Overdubbing,
+		State_Playing,
+		State_Stopped
+	};
+	enum Action {
+		Action_Record,
+		Action_CloseLoop,
+		Action_Stop,
+		Action_Play,
+		// between overdubbing and playing back
+		Action_Overdub,
+		Action_Clear
+	};
+
+	Looper();
+
+	void Perform(Action action);
+	void Process(float *block, size_t count, bool liveInput);
+
+	State GetState() const;
+	int GetLayers() const;
+	size_t GetPosition() const;
+	size_t GetLength() const;
+};
+
+#endif
+
@@ -1,231 +1,463 @@
 #include "constants.hh"
+#include "bench.hh"
+#include "cache.hh"
+#include "compiler.hh"
 #include "conv.hh"
-#include "font.hh"
+#include "engine.hh"
 #include "fontloader.hh"
 #include "gui.hh"
+#include "input.hh"
 #include "key.hh"
+#include "keyboard.hh"
+#include "midi.hh"
 #include "note_atlas.hh"
 #include "note.hh"
-#include "script.hh"
+#include "patches.hh"
+#include "profiler.hh"
+#include "resources.hh"
+#include "scope.hh"
+#include "session.hh"
+#include "take.hh"
 
 #include <GL/glew.h>
 #include <SFML/OpenGL.hpp>
 #include <SFML/System.hpp>
-#include "../bzip2-1.0.6/bzlib.h"
 #include "../imgui/imgui.h"
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <sys/resource.h>
+#include <sys/stat.h>
+
+// from Xlib, declared here rather than pulling X11/Xlib.h and its macros
+// in next to SFML
+extern "C" int XInitThreads(void);
+
+// Phases of startup and when they ran, printed with --startup-report.
+// Phases running on other threads are added from there.
+class StartupReport
+{
+	struct Phase {
+		std::string name, thread;
+		sf::Time start, end;
+	};
+	sf::Clock clock;
+	std::mutex mutex;
+	std::vector<Phase> phases;
+public:
+	sf::Time Now() const {
+		return clock.getElapsedTime();
+	}
+	void Add(const char *name, sf::Time start, const char *thread = "main") {
+		Add(name, start, Now(), thread);
+	}
+	void Add(const char *name, sf::Time start, sf::Time end, const char *thread) {
+		std::lock_guard<std::mutex> lock(mutex);
+		phases.push_back({ name, thread, start, end });
+	}
+	void Print(sf::Time firstPlayable) {
+		std::lock_guard<std::mutex> lock(mutex);
+		puts("Startup:");
+		for (auto &phase : phases)
+			printf("  %-8s %-24s %8.1f ms  (%.1f - %.1f)\n",
+					phase.thread.c_str(), phase.name.c_str(),
+					(phase.end - phase.start).asMicroseconds()/1000.,
+					phase.start.asMicroseconds()/1000.,
+					phase.end.asMicroseconds()/1000.);
+		printf("  first playable key at %.1f ms\n",
+				firstPlayable.asMicroseconds()/1000.);
+	}
+};
 
+// Owns the window and decides which iterations of the main loop draw a
+// frame. With redrawing on demand, a frame is drawn when something
+// changed and for a few frames after, otherwise the loop only polls input
+// and sleeps. Headless, there is no window, only an offscreen target of
+// the same size for the benchmark to draw to; SFML still gets its GL
+// context from GLX, so an X display is needed all the same, Xvfb will do.
 class MainLoop
 {
+	bool headless;
+	bool verticalSync;
+	int frameLimit;
+	int settleFrames;
+
+	sf::Time cpuSampleStart;
+	double cpuTimeAtSampleStart;
+	int framesSinceSample;
+
+	static double cpuTime() {
+		struct rusage usage;
+		getrusage(RUSAGE_SELF, &usage);
+		return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec/1e6 +
+			usage.ru_stime.tv_sec + usage.ru_stime.tv_usec/1e6;
+	}
+	void applyRenderSettings() {
+		if (headless)
+			return;
+		if (verticalSync != Globals.verticalSync) {
+			verticalSync = Globals.verticalSync;
+			window.setVerticalSyncEnabled(verticalSync);
+		}
+		if (frameLimit != Globals.frameLimit) {
+			frameLimit = Globals.frameLimit;
+			window.setFramerateLimit(frameLimit);
+		}
+	}
 public:
 	sf::RenderWindow window;
-	sf::Event event;
+	sf::RenderTexture offscreen;
 	sf::Time simulatedTime;
 	sf::Clock clock;
-	MainLoop() {
-		sf::ContextSettings settings;
-		settings.antialiasingLevel = Constants.antialiasing;
-		settings.majorVersion = 2;
-		settings.minorVersion = 1;
-		window.create(sf::VideoMode(Globals.windowWidth, Globals.windowHeight),
-				"sythin2",
-				sf::Style::Titlebar | sf::Style::Close,
-				settings);
-		window.setKeyRepeatEnabled(false);
+	// process CPU time in percent of one core, all threads included
+	float cpuPercent;
+	float framesPerSecond;
+
+	explicit MainLoop(bool nHeadless) {
+		headless = nHeadless;
+		if (headless) {
+			offscreen.create(Globals.windowWidth, Globals.windowHeight);
+			offscreen.setActive(true);
+			// sets the viewport, which ImGui's drawing relies on
+			offscreen.resetGLStates();
+		} else {
+			sf::ContextSettings settings;
+			settings.antialiasingLevel = Constants.antialiasing;
+			settings.majorVersion = 2;
+			settings.minorVersion = 1;
+			window.create(sf::VideoMode(Globals.windowWidth, Globals.windowHeight),
+					"sythin2",
+					sf::Style::Titlebar | sf::Style::Close,
+					settings);
+			window.setKeyRepeatEnabled(false);
+		}
+
+		verticalSync = !Globals.verticalSync;
+		frameLimit = -1;
+		applyRenderSettings();
+		settleFrames = Constants.render.settleFrames;
+
+		cpuTimeAtSampleStart = cpuTime();
+		framesSinceSample = 0;
+		cpuPercent = 0;
+		framesPerSecond = 0;
 	};
 	bool Update() {
-		window.clear(Constants.backgroundColor);
 		return window.isOpen() && !Globals.quit;
 	}
+	void Invalidate() {
+		settleFrames = Constants.render.settleFrames;
+	}
+	bool ShouldDraw(bool changed) {
+		applyRenderSettings();
+		if (changed)
+			Invalidate();
+		if (!Globals.redrawOnDemand)
+			return true;
+		if (settleFrames == 0)
+			return false;
+		settleFrames--;
+		return true;
+	}
+	// true whenever new figures are available
+	bool SampleCpu() {
+		const sf::Time now = clock.getElapsedTime();
+		const float elapsed = (now - cpuSampleStart).asSeconds();
+		if (elapsed*1000 < Constants.render.cpuSampleMilliseconds)
+			return false;
+		const double time = cpuTime();
+		cpuPercent = 100*(time - cpuTimeAtSampleStart)/elapsed;
+		framesPerSecond = framesSinceSample/elapsed;
+		cpuSampleStart = now;
+		cpuTimeAtSampleStart = time;
+		framesSinceSample = 0;
+		return true;
+	}
+	void Clear() {
+		window.clear(Constants.backgroundColor);
+	}
 	void Display() {
 		window.display();
+		framesSinceSample++;
 	}
 };
 
-int main()
+static bool readFile(const char *filename, std::string *text)
 {
-	Script script;
+	FILE *f = fopen(filename, "rb");
+	if (!f)
+		return false;
+	char buffer[4096];
+	size_t read;
+	text->clear();
+	while ((read = fread(buffer, 1, sizeof(buffer), f)) > 0)
+		text->append(buffer, read);
+	fclose(f);
+	return true;
+}
 
-	MainLoop ml;
+static bool newerThan(const char *filename, const char *other)
+{
+	struct stat a, b;
+	if (stat(filename, &a) || stat(other, &b))
+		return false;
+	return a.st_mtim.tv_sec != b.st_mtim.tv_sec ?
+		a.st_mtim.tv_sec > b.st_mtim.tv_sec :
+		a.st_mtim.tv_nsec > b.st_mtim.tv_nsec;
+}
 
-	Gui gui;
+// The script of a session goes back into wave.lua, where the editor and
+// the compiler read it from. Left alone when it's the same, so that
+// starting up doesn't touch the disk for nothing, and when it was edited
+// after the session was saved. What it held before goes to wave.lua.bak.
+static void restoreScript(const Session &session, const char *sessionFile)
+{
+	size_t size;
+	const char *script = session.Script(&size);
+	std::string current;
+	if (readFile("wave.lua", &current) &&
+			current.size() == size && !memcmp(current.data(), script, size))
+		return;
+	if (newerThan("wave.lua", sessionFile)) {
+		printf("\"wave.lua\" changed after the session was saved, "
+				"keeping it\n");
+		return;
+	}
+	FILE *f = fopen("wave.lua.tmp", "wb");
+	if (!f) {
+		printf("Failed to restore \"wave.lua\" from the session\n");
+		return;
+	}
+	bool ok = fwrite(script, 1, size, f) == size;
+	ok = fclose(f) == 0 && ok;
+	const bool backedUp = ok && !rename("wave.lua", "wave.lua.bak");
+	if (ok && !backedUp && errno != ENOENT)
+		ok = false;
+	if (!ok || rename("wave.lua.tmp", "wave.lua")) {
+		remove("wave.lua.tmp");
+		if (backedUp)
+			rename("wave.lua.bak", "wave.lua");
+		printf("Failed to restore \"wave.lua\" from the session\n");
+	}
+}
 
-	sf::Font sfFont;
-	ImFont *imFont;
-	std::unique_ptr<char> fontFileBuffer;
-	if (!FontLoader::loadEmbeddedFont(sfFont, imFont,
-				fontFileBuffer,
-				_CommeLight_ttf.data, _CommeLight_ttf.size))
-		return 1;
+// what patches are preloaded with
+static std::vector<int> voicesOnScreen(const Keyboard &keyboard)
+{
+	std::vector<int> voices;
+	for (size_t i = 0; i < keyboard.KeysOnScreen(); i++)
+		voices.push_back(i);
+	return voices;
+}
 
-	gui.CreateFontTexture(imFont);
+// what a compile renders again: whatever is resident, or to begin with
+// the keys on screen
+static std::vector<int> voicesToCompile(const Keyboard &keyboard,
+		const SampleCache &cache)
+{
+	std::vector<int> voices = cache.Resident(0);
+	if (voices.empty())
+		voices = voicesOnScreen(keyboard);
+	return voices;
+}
 
-	sf::Texture noteNamesAtlas;
-	if (!note_atlas::CreateNoteTexture(sfFont, &noteNamesAtlas))
-		return 1;
+int main(int argc, char **argv)
+{
+	// window events are read on the input thread while the main thread
+	// draws, Xlib has to know before anything opens the display
+	XInitThreads();
+	StartupReport report;
+	const char *layoutFile = nullptr;
+	const char *sessionFile = Constants.defaultSessionFile;
+	bool useMidi = true;
+	bool startupReport = false;
+	const char *benchOutput = nullptr, *benchScript = nullptr;
+	const char *traceOutput = nullptr;
+	bool codecBench = false;
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--layout") && i + 1 < argc)
+			layoutFile = argv[++i];
+		else if (!strcmp(argv[i], "--session") && i + 1 < argc)
+			sessionFile = argv[++i];
+		else if (!strcmp(argv[i], "--no-midi"))
+			useMidi = false;
+		else if (!strcmp(argv[i], "--startup-report"))
+			startupReport = true;
+		else if (!strcmp(argv[i], "--headless-bench") && i + 1 < argc)
+			benchOutput = argv[++i];
+		else if (!strcmp(argv[i], "--bench-script") && i + 1 < argc)
+			benchScript = argv[++i];
+		else if (!strcmp(argv[i], "--trace") && i + 1 < argc)
+			traceOutput = argv[++i];
+		else if (!strcmp(argv[i], "--codec-bench"))
+			codecBench = true;
+		else {
+			printf("Usage: %s [--layout <file>] [--session <file>] [--no-midi]\n"
+					"       [--startup-report]\n"
+					"       [--headless-bench <out.json> [--bench-script <file>]]\n"
+					"       [--trace <out.json>] [--codec-bench]\n"
+					"--headless-bench opens no window but still needs an X display;\n"
+					"without one, run it under Xvfb, e.g. xvfb-run %s --headless-bench ...\n",
+					argv[0], argv[0]);
+			return 1;
+		}
+	}
+	// Mesa's software rasteriser, so that the figures don't depend on the
+	// GPU of the machine the benchmark runs on. Needs to be set before the
+	// first context is created.
+	if (benchOutput) {
+		setenv("LIBGL_ALWAYS_SOFTWARE", "1", 0);
+		useMidi = false;
+		if (!getenv("DISPLAY")) {
+			printf("--headless-bench needs an X display for its GL context, "
+					"run it under Xvfb: xvfb-run %s --headless-bench %s\n",
+					argv[0], benchOutput);
+			return 1;
+		}
+	}
+	// from here on every thread records, startup included
+	profiler::SetThreadName("main");
+	if (traceOutput) {
+		if (!profiler::StartTrace(traceOutput))
+			return 1;
+		profiler::SetEnabled(true);
+	}
 
-	Key keys[3][12];
-	int hue = 0;
-	for (int r = 0; r < 3; r++)
-		for (int i = 11; i >= 0; i--) {
-			keys[r][i].SetHue((hue++/36.0)*360);
-			int x = Constants.padding + i*(Constants.rectangle.size + Constants.padding);
-			int y = Globals.windowHeight - Constants.padding - Constants.rectangle.size -
-				(3-r-1)*(Constants.rectangle.size + Constants.padding);
-			keys[r][i].SetPosition(x, y);
-			keys[r][i].SetTexture(&noteNamesAtlas);
+	// Nothing below needs a GL context until the window exists, so the
+	// notes start rendering and the ImGui font atlas starts rasterising
+	// right away, while the window, GLEW and shaders are set up.
+	// benchmarks run from the same state every time
+	sf::Time phaseStart = report.Now();
+	Session session;
+	const bool useSession = !benchOutput && !codecBench;
+	const bool sessionLoaded = useSession && session.Map(sessionFile);
+	if (sessionLoaded) {
+		Globals.volume = session.Volume();
+		Globals.compressBanks = session.CompressBanks();
+		Globals.bankCacheMegabytes = session.BankCacheMegabytes();
+		restoreScript(session, sessionFile);
+	}
+	report.Add("session", phaseStart);
+
+	// a layout given on the command line wins over the one of the session
+	phaseStart = report.Now();
+	Keyboard keyboard;
+	size_t mappingCount;
+	int rows;
+	const Keyboard::Mapping *mappings = session.IsMapped() && !layoutFile ?
+		session.Mappings(&mappingCount, &rows) : nullptr;
+	if (!mappings || !keyboard.SetMappings(rows, mappings, mappingCount))
+		if (!keyboard.LoadLayout(layoutFile ? layoutFile :
+					Constants.defaultLayoutFile))
+			return 1;
+	report.Add("layout", phaseStart);
+
+	phaseStart = report.Now();
+	Compiler compiler;
+	SampleCache cache;
+	PatchLibrary patches;
+	// pinned before the compile gets to prune the disk cache
+	if (!benchOutput && !codecBench)
+		patches.Scan(Constants.patches.directory, &compiler, &cache,
+				keyboard.keys.size());
+	compiler.Compile("wave.lua", keyboard.Notes(),
+			voicesToCompile(keyboard, cache), Globals.volume,
+			Globals.compressBanks && !codecBench);
+	patches.Preload(&compiler, keyboard.Notes(), voicesOnScreen(keyboard),
+			Globals.volume, Globals.compressBanks);
+	const sf::Time compileStart = report.Now();
+	report.Add("lua state", phaseStart);
+
+	if (codecBench) {
+		Compiler::Result result;
+		while (!compiler.Collect(&result))
+			sf::sleep(sf::milliseconds(1));
+		if (!result.error.empty()) {
+			printf("%s\n", result.error.c_str());
+			return 1;
 		}
+		RunCodecBenchmark(result.samples);
+		return 0;
+	}
 
-	keys[0][ 0].key = sf::Keyboard::Num1;
-	keys[0][ 1].key = sf::Keyboard::Num2;
-	keys[0][ 2].key = sf::Keyboard::Num3;
-	keys[0][ 3].key = sf::Keyboard::Num4;
-	keys[0][ 4].key = sf::Keyboard::Num5;
-	keys[0][ 5].key = sf::Keyboard::Num6;
-	keys[0][ 6].key = sf::Keyboard::Num7;
-	keys[0][ 7].key = sf::Keyboard::Num8;
-	keys[0][ 8].key = sf::Keyboard::Num9;
-	keys[0][ 9].key = sf::Keyboard::Num0;
-	keys[0][10].key = sf::Keyboard::Dash;
-	keys[0][11].key = sf::Keyboard::Equal;
-	keys[0][ 0].note = Note(note::C,  4);
-	keys[0][ 1].note = Note(note::Cs, 4);
-	keys[0][ 2].note = Note(note::D,  4);
-	keys[0][ 3].note = Note(note::Ds, 4);
-	keys[0][ 4].note = Note(note::E,  4);
-	keys[0][ 5].note = Note(note::F,  4);
-	keys[0][ 6].note = Note(note::Fs, 4);
-	keys[0][ 7].note = Note(note::G,  4);
-	keys[0][ 8].note = Note(note::Gs, 4);
-	keys[0][ 9].note = Note(note::A,  4);
-	keys[0][10].note = Note(note::As, 4);
-	keys[0][11].note = Note(note::B,  4);
-
-	keys[1][ 0].key = sf::Keyboard::Q;
-	keys[1][ 1].key = sf::Keyboard::W;
-	keys[1][ 2].key = sf::Keyboard::E;
-	keys[1][ 3].key = sf::Keyboard::R;
-	keys[1][ 4].key = sf::Keyboard::T;
-	keys[1][ 5].key = sf::Keyboard::Y;
-	keys[1][ 6].key = sf::Keyboard::U;
-	keys[1][ 7].key = sf::Keyboard::I;
-	keys[1][ 8].key = sf::Keyboard::O;
-	keys[1][ 9].key = sf::Keyboard::P;
-	keys[1][10].key = sf::Keyboard::LBracket;
-	keys[1][11].key = sf::Keyboard::RBracket;
-	keys[1][ 0].note = Note(note::C,  3);
-	keys[1][ 1].note = Note(note::Cs, 3);
-	keys[1][ 2].note = Note(note::D,  3);
-	keys[1][ 3].note = Note(note::Ds, 3);
-	keys[1][ 4].note = Note(note::E,  3);
-	keys[1][ 5].note = Note(note::F,  3);
-	keys[1][ 6].note = Note(note::Fs, 3);
-	keys[1][ 7].note = Note(note::G,  3);
-	keys[1][ 8].note = Note(note::Gs, 3);
-	keys[1][ 9].note = Note(note::A,  3);
-	keys[1][10].note = Note(note::As, 3);
-	keys[1][11].note = Note(note::B,  3);
-
-	keys[2][ 0].key = sf::Keyboard::A;
-	keys[2][ 1].key = sf::Keyboard::S;
-	keys[2][ 2].key = sf::Keyboard::D;
-	keys[2][ 3].key = sf::Keyboard::F;
-	keys[2][ 4].key = sf::Keyboard::G;
-	keys[2][ 5].key = sf::Keyboard::H;
-	keys[2][ 6].key = sf::Keyboard::J;
-	keys[2][ 7].key = sf::Keyboard::K;
-	keys[2][ 8].key = sf::Keyboard::L;
-	keys[2][ 9].key = sf::Keyboard::SemiColon;
-	keys[2][10].key = sf::Keyboard::Quote;
-	keys[2][11].key = sf::Keyboard::Return;
-	keys[2][ 0].note = Note(note::C,  2);
-	keys[2][ 1].note = Note(note::Cs, 2);
-	keys[2][ 2].note = Note(note::D,  2);
-	keys[2][ 3].note = Note(note::Ds, 2);
-	keys[2][ 4].note = Note(note::E,  2);
-	keys[2][ 5].note = Note(note::F,  2);
-	keys[2][ 6].note = Note(note::Fs, 2);
-	keys[2][ 7].note = Note(note::G,  2);
-	keys[2][ 8].note = Note(note::Gs, 2);
-	keys[2][ 9].note = Note(note::A,  2);
-	keys[2][10].note = Note(note::As, 2);
-	keys[2][11].note = Note(note::B,  2);
-
-	for (int r = 0; r < 3; r++)
-		for (int i = 0; i < 12; i++)
-			keys[r][i].CreateSprites();
-
-	while (ml.Update()) {
-		sf::Time realTime = ml.clock.getElapsedTime();
-		while (ml.simulatedTime < realTime) {
-			while (ml.window.pollEvent(ml.event)) {
-				switch (ml.event.type) {
-					case sf::Event::Closed:
-						ml.window.close();
-						break;
-					case sf::Event::KeyPressed: {
-						ImGuiIO& io = ImGui::GetIO();
-						io.KeysDown[ml.event.key.code] = true;
-						io.KeyCtrl = ml.event.key.control;
-						io.KeyShift = ml.event.key.shift;
-						if (Globals.playingOnKeys)
-							for (int r = 0; r < 3; r++)
-								for (int i = 0; i < 12; i++)
-									if (ml.event.key.code == keys[r][i].key) {
-										keys[r][i].keyPressed = true;
-										keys[r][i].KeyPressed();
-										// 10 levels of indentation woo
-									}
-						break;
-					}
-					case sf::Event::KeyReleased: {
-						ImGuiIO& io = ImGui::GetIO();
-						io.KeysDown[ml.event.key.code] = false;
-						io.KeyCtrl = ml.event.key.control;
-						io.KeyShift = ml.event.key.shift;
-						if (Globals.playingOnKeys)
-							for (int r = 0; r < 3; r++)
-								for (int i = 0; i < 12; i++)
-									if (ml.event.key.code == keys[r][i].key) {
-										keys[r][i].keyPressed = false;
-										keys[r][i].KeyReleased();
-									}
-						break;
-					}
-					case sf::Event::TextEntered:
-						if (ml.event.text.unicode > 0 &&
-								ml.event.text.unicode < 0x10000)
-							ImGui::GetIO().AddInputCharacter(ml.event.text.unicode);
-						break;
-					case sf::Event::MouseButtonPressed:
-						gui.mousePressed[ml.event.mouseButton.button] = true;
-						break;
-					case sf::Event::MouseButtonReleased:
-						gui.mousePressed[ml.event.mouseButton.button] = false;
-						break;
-					case sf::Event::MouseWheelMoved:
-						ImGui::GetIO().MouseWheel += (float)ml.event.mouseWheel.delta;
-						break;
-					case sf::Event::MouseMoved:
-						gui.mousePosX = ml.event.mouseMove.x;
-						gui.mousePosY = ml.event.mouseMove.y;
-						break;
-					default:
-						break;
-				}
-			}
+	ImFont *guiFont = nullptr, *labelFont = nullptr;
+	std::thread fontThread([&report, &guiFont, &labelFont]() {
+		profiler::SetThreadName("font");
+		const sf::Time start = report.Now();
+		FontLoader::loadEmbeddedFonts(guiFont, labelFont,
+				resources::commeLightTtf, resources::fontAtlas);
+		report.Add("font atlas", start, report.Now(), "font");
+	});
 
-			gui.Update(Constants.updateMilliseconds);
+	phaseStart = report.Now();
+	MainLoop ml(benchOutput != nullptr);
+	report.Add("window", phaseStart);
 
-			ml.simulatedTime += sf::milliseconds(Constants.updateMilliseconds);
-		}
+	phaseStart = report.Now();
+	Gui gui;
+	report.Add("glew and shaders", phaseStart);
+
+	phaseStart = report.Now();
+	fontThread.join();
+	if (!guiFont || !labelFont)
+		return 1;
+	report.Add("wait for font atlas", phaseStart);
+
+	phaseStart = report.Now();
+	gui.CreateFontTexture(guiFont);
+
+	note_atlas::Init(labelFont, gui.fontTexture.getSize());
+	keyboard.Place(&gui.fontTexture);
+	report.Add("textures", phaseStart);
+
+	phaseStart = report.Now();
+	Engine engine(keyboard.keys.size(), &ml.clock);
+	if (!benchOutput)
+		engine.play();
+	report.Add("audio", phaseStart);
+
+	Take take;
+	Scope scope;
+	if (session.IsMapped()) {
+		size_t eventCount;
+		const Take::Event *events = session.Events(&eventCount);
+		take.Load(events, eventCount);
+		compiler.PinBanks(sessionFile, session.BankScriptKey());
+		session.Unmap();
+	}
 
+	// running without a sequencer is fine, the keyboard still plays
+	phaseStart = report.Now();
+	MidiInput midi(&keyboard, &engine, &ml.clock);
+	const bool midiOpen = useMidi && midi.Open("sythin2");
+	report.Add("midi", phaseStart);
+
+	Input input(&keyboard, &engine, &gui, &take, midiOpen ? &midi : nullptr,
+			&ml.clock);
+
+	// every patch plays whatever SampleCache has of it, the rest is
+	// rendered once played, as usual
+	auto switchPatch = [&](int index) {
+		SampleSet banks =
+			std::make_shared<const std::vector<Samples>>(cache.Banks(index));
+		keyboard.SetSamples(*banks);
+		engine.SetPatch(banks);
+		patches.SetActive(index);
+	};
+
+	// everything ImGui draws in a frame, up to but not including rendering
+	auto buildFrame = [&]() {
+		profiler::Zone zone(profiler::Zone_BuildFrame);
 		ImGui::NewFrame();
 
 		gui.TabBar();
 
 		if (gui.BeginSettingsWindow()) {
-			if (ImGui::CollapsingHeader("Sampling options")) {
+			if (gui.SettingsHeader("Sampling options")) {
 				ImGui::Text("Preview");
 				static int samplesInPreview = 2000;
 				float samplesInPreviewFloat = samplesInPreview;
@@ -237,70 +469,287 @@ int main()
 
 				ImGui::Spacing();
 
-#if 0
-				struct {
-					Key *key;
-					const char *noteName;
-					float samples[44100];
-				} previewNotes[5] = {
-					{ &keys[2][ 0], "C2",  {} },
-					{ &keys[2][10], "A#2", {} },
-					{ &keys[1][ 3], "D#3", {} },
-					{ &keys[0][ 1], "C#4", {} },
-					{ &keys[0][11], "B4",  {} }
-				};
-				for (int n = 0; n < 5; n++) {
-					double x = 0;
-					for (int i = 0; i < samplesInPreview; i++) {
-						previewNotes[n].samples[i] = Globals.volume*
-							sin(2*M_PI*previewNotes[n].key->baseFrequency*x);
-						x += 1.0/Constants.samplesPerSecond;
-					}
-					ImGui::PlotLines(previewNotes[n].noteName, previewNotes[n].samples,
-							samplesInPreview, 0, "", -32767, 32767,
-							ImVec2(0, Constants.gui.graphHeight));
-				}
-#endif
+				gui.NotePreviews(samplesInPreview);
 
 				ImGui::Spacing();
 
-				static float volumePercent = Constants.gui.volumePercent;
+				static float volumePercent = sessionLoaded ?
+					Globals.volume*100.0/32767 : Constants.gui.volumePercent;
 				ImGui::SliderFloat("volume", &volumePercent, 0.0f, 100.0f, "%.1f%%");
 				Globals.volume = (32767.0*volumePercent)/100.0;
 
 				ImGui::Spacing();
 
+				ImGui::Checkbox("compress sample banks", &Globals.compressBanks);
+				ImGui::SliderInt("bank memory", &Globals.bankCacheMegabytes,
+						1, Constants.gui.bankCacheMegabytesMax, "%.0f MB");
+				ImGui::Text("sample banks: %.1f MB, %zu of %zu notes",
+						cache.ResidentBytes()/1048576.,
+						cache.Resident(patches.Active()).size(),
+						keyboard.keys.size());
+
+				ImGui::Spacing();
+
 				if (ImGui::TreeNode("Volume/Frequency compensation\n"
 							"(now disabled in code beacause it's shit)"))
 					ImGui::TreePop();
 			}
+			if (gui.SettingsHeader("Patches")) {
+				for (size_t i = 0; i < patches.Count(); i++) {
+					const PatchLibrary::Patch &patch = patches.Get(i);
+					std::string label = patch.name;
+					if (patch.loading)
+						label += " (loading)";
+					else if (!patch.error.empty())
+						label += " (failed)";
+					if (ImGui::Selectable(label.c_str(), patches.Active() == (int)i)) {
+						patches.Select(i);
+						patches.Preload(&compiler, keyboard.Notes(),
+								voicesOnScreen(keyboard), Globals.volume,
+								Globals.compressBanks);
+					}
+					if (!patch.error.empty() && ImGui::IsItemHovered())
+						ImGui::SetTooltip("%s", patch.error.c_str());
+				}
+				// with the volume and compression set now
+				if (ImGui::Button("reload patches")) {
+					patches.Scan(Constants.patches.directory, &compiler,
+							&cache, keyboard.keys.size());
+					patches.Preload(&compiler, keyboard.Notes(),
+							voicesOnScreen(keyboard), Globals.volume,
+							Globals.compressBanks);
+					patches.Select(0);
+				}
+			}
+			if (gui.SettingsHeader("Output"))
+				gui.OutputScope(&scope);
+			if (gui.SettingsHeader("Rendering")) {
+				ImGui::Checkbox("vertical sync", &Globals.verticalSync);
+				ImGui::SliderInt("frame limit", &Globals.frameLimit,
+						0, Constants.render.frameLimitMax, "%.0f fps");
+				ImGui::Checkbox("redraw only on change", &Globals.redrawOnDemand);
+				ImGui::Text("CPU: %.1f%% of a core, %.0f frames/s",
+						ml.cpuPercent, ml.framesPerSecond);
+			}
+			if (gui.SettingsHeader("Debugging")) {
+				const Script::MemoryStats lua = compiler.ScriptStats();
+				ImGui::Text("Lua heap: %.1f KB, peak %.1f KB, pools %.1f KB",
+						lua.heapBytes/1024., lua.peakBytes/1024.,
+						lua.poolBytes/1024.);
+				ImGui::Text("Lua allocations: %llu, frees %llu, reallocations %llu",
+						(unsigned long long)lua.allocations,
+						(unsigned long long)lua.frees,
+						(unsigned long long)lua.reallocations);
+				ImGui::Text("Lua collector: %llu full collections, %llu idle steps",
+						(unsigned long long)lua.forcedCollections,
+						(unsigned long long)lua.idleSteps);
+			}
 			ImGui::End();
 		}
 
-		static bool shouldCompile = true;
+		bool shouldCompile = false;
 		gui.WaveWindow(&shouldCompile);
-		if (shouldCompile) {
-			script.CopyAndExecute("wave.lua");
-			for (int r = 0; r < 3; r++)
-				for (int i = 0; i < 12; i++)
-					keys[r][i].note.GenerateSamples(&script);
-			shouldCompile = false;
-		}
+		gui.PianoRollWindow(&take, input.IsWriting() ?
+				input.TakeTime(ml.clock.getElapsedTime()) : take.GetLength());
+		gui.PerformanceWindow();
+		if (shouldCompile)
+			compiler.Compile("wave.lua", keyboard.Notes(),
+					voicesToCompile(keyboard, cache), Globals.volume,
+					Globals.compressBanks);
 
-		gui.MainMenuBar();
+		gui.MainMenuBar(&engine);
 
 		if (Globals.showDemo)
 			ImGui::ShowTestWindow(&Globals.showDemo);
+	};
 
+	// A compile replaces every bank, what is rendered later joins them; a
+	// compile that failed leaves the old ones playing, and the keys a
+	// failed render was for are asked for again once played. Keys played
+	// before their samples got here start sounding now. Compiling switches
+	// back to wave.lua, rendering only reaches the keys while it's the
+	// patch. The same goes for the banks of the other patches.
+	auto applyResult = [&](const Compiler::Result &result) {
+		const sf::Time now = ml.clock.getElapsedTime();
+		int patch;
+		if (patches.Loaded(result, &cache, &patch)) {
+			if (patch < 0 || patch != patches.Active())
+				return;
+			for (size_t n = 0; n < result.voices.size(); n++) {
+				const int voice = result.voices[n];
+				keyboard.SetSamples(voice, result.samples[n]);
+				engine.SetSamples(voice, result.samples[n]);
+				if (keyboard.keys[voice].keyPressed)
+					keyboard.keys[voice].KeyPressed(&engine, now);
+			}
+			return;
+		}
+		if (result.compiled || !result.error.empty())
+			Globals.errorMessage = result.error;
+		if (!result.error.empty())
+			cache.Retry(0);
+		if (result.compiled && result.error.empty()) {
+			// the session is saved with the banks of this script, which
+			// are kept anyway while it is loaded
+			compiler.UnpinBanks(sessionFile);
+			patches.SetActive(0);
+			std::vector<Samples> banks(keyboard.keys.size());
+			std::vector<Note> notes;
+			for (size_t n = 0; n < result.voices.size(); n++) {
+				banks[result.voices[n]] = result.samples[n];
+				notes.push_back(keyboard.keys[result.voices[n]].note);
+			}
+			keyboard.SetSamples(banks);
+			engine.SetSamples(banks);
+			gui.SetPreviews(notes, result.summaries);
+			cache.Invalidate(0, keyboard.keys.size());
+		}
+		for (size_t n = 0; n < result.voices.size(); n++) {
+			const int voice = result.voices[n];
+			cache.Insert(0, voice, result.samples[n]);
+			if (result.compiled || patches.Active() != 0)
+				continue;
+			keyboard.SetSamples(voice, result.samples[n]);
+			engine.SetSamples(voice, result.samples[n]);
+			if (keyboard.keys[voice].keyPressed)
+				keyboard.keys[voice].KeyPressed(&engine, now);
+		}
+	};
+
+	if (benchOutput) {
+		Compiler::Result result;
+		while (!compiler.Collect(&result))
+			sf::sleep(sf::milliseconds(1));
+		applyResult(result);
+
+		Benchmark benchmark(&gui, &keyboard, &take, &input, &ml.clock);
+		if (!benchmark.LoadScript(benchScript))
+			return 1;
+		benchmark.Run(&ml.offscreen, buildFrame);
+		profiler::StopTrace();
+		if (!benchmark.WriteJson(benchOutput))
+			return 1;
+		return benchmark.CheckLatency() ? 0 : 1;
+	}
+
+	input.Start([&ml](Input::Event *event) {
+		if (!ml.window.pollEvent(event->event))
+			return false;
+		event->stamp = ml.clock.getElapsedTime();
+		return true;
+	});
+
+	bool playable = false;
+
+	while (ml.Update() && !input.Closed()) {
+		// zones are only recorded while someone is looking at them
+		const bool profiling = Globals.tab == GlobalsHolder::Tab_Performance;
+		profiler::SetEnabled(profiling || traceOutput);
+		profiler::Collect();
+
+		// notes have reached the engine already, this catches the GUI up
+		bool changed = input.Poll();
+
+		sf::Time realTime = ml.clock.getElapsedTime();
+		input.UpdateMode(realTime);
+		while (ml.simulatedTime < realTime) {
+			gui.Update(Constants.updateMilliseconds);
+
+			ml.simulatedTime += sf::milliseconds(Constants.updateMilliseconds);
+		}
+
+		const int ready = patches.TakeReady();
+		if (ready >= 0)
+			switchPatch(ready);
+
+		const int activePatch = patches.Active();
+		std::vector<bool> held(keyboard.keys.size());
+		for (size_t i = 0; i < keyboard.keys.size(); i++) {
+			if (keyboard.keys[i].played) {
+				keyboard.keys[i].played = false;
+				cache.Played(activePatch, i);
+			}
+			held[i] = keyboard.keys[i].keyPressed;
+		}
+		const std::vector<int> missing = cache.TakeMissing(activePatch);
+		if (activePatch == 0 && !missing.empty())
+			compiler.Render(missing);
+		else if (activePatch != 0)
+			patches.Render(&compiler, activePatch, keyboard.Notes(), missing);
+
+		Compiler::Result result;
+		while (compiler.Collect(&result)) {
+			applyResult(result);
+			changed = true;
+
+			if (result.compiled && !playable && startupReport) {
+				sf::Time load, generate;
+				compiler.LastTimings(&load, &generate);
+				report.Add("wave script", compileStart, compileStart + load,
+						"compiler");
+				report.Add("note samples", compileStart + load,
+						compileStart + load + generate, "compiler");
+				report.Print(report.Now());
+			}
+			playable |= result.compiled;
+		}
+		// a compile collected above may have switched back to wave.lua
+		for (int voice : cache.Evict((size_t)Globals.bankCacheMegabytes << 20,
+					patches.Active(), held)) {
+			keyboard.SetSamples(voice, Samples());
+			engine.SetSamples(voice, Samples());
+		}
+		engine.FreeReleased();
+		if (Globals.compiling != compiler.IsBusy()) {
+			Globals.compiling = !Globals.compiling;
+			changed = true;
+		}
+		// the figures and the scope are only on show in the settings tab,
+		// but the ring is drained regardless so that it never fills up
+		if (ml.SampleCpu() && Globals.tab == GlobalsHolder::Tab_Settings)
+			changed = true;
+		if (scope.Pull(&engine.output) && Globals.tab == GlobalsHolder::Tab_Settings)
+			changed = true;
+
+		// things that move on their own, or ImGui widgets being dragged
+		// or typed into
+		const Looper::State looperState = engine.looper.GetState();
+		const ImGuiIO &io = ImGui::GetIO();
+		const bool animating = profiling || input.IsWriting() ||
+			looperState == Looper::State_Recording ||
+			looperState == Looper::State_Overdubbing ||
+			looperState == Looper::State_Playing ||
+			ImGui::IsAnyItemActive() || io.MouseDown[0] || io.MouseDown[1];
+
+		if (!ml.ShouldDraw(changed || animating)) {
+			sf::sleep(sf::milliseconds(Constants.render.idleSleepMilliseconds));
+			continue;
+		}
+
+		input.FlushToGui();
+
+		buildFrame();
+
+		if (input.Poll())
+			ml.Invalidate();
+
+		ml.Clear();
 		gui.Draw();
 
-		for (int r = 0; r < 3; r++)
-			for (int i = 0; i < 12; i++)
-				keys[r][i].Draw(&ml.window);
+		keyboard.Draw(&ml.window);
+
+		if (input.Poll())
+			ml.Invalidate();
 
 		ml.Display();
 	}
+	input.Stop();
+
+	std::string script;
+	if (useSession && readFile("wave.lua", &script))
+		Session::Save(sessionFile, script, keyboard, take, compiler.ScriptKey());
 
+	profiler::StopTrace();
 	return 0;
 }
 
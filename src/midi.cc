@@ -0,0 +1,127 @@
+#include "midi.hh"
+#include "profiler.hh"
+
+MidiInput::MidiInput(Keyboard *nKeyboard, Engine *nEngine,
+		const sf::Clock *nClock)
+{
+	keyboard = nKeyboard;
+	engine = nEngine;
+	clock = nClock;
+	seq = nullptr;
+	port = -1;
+	queue = -1;
+	quit = false;
+}
+
+bool MidiInput::Open(const char *clientName)
+{
+	int err = snd_seq_open(&seq, "default", SND_SEQ_OPEN_INPUT, 0);
+	if (err < 0) {
+		printf("Failed to open ALSA sequencer: %s\n", snd_strerror(err));
+		seq = nullptr;
+		return false;
+	}
+	snd_seq_set_client_name(seq, clientName);
+
+	port = snd_seq_create_simple_port(seq, "input",
+			SND_SEQ_PORT_CAP_WRITE | SND_SEQ_PORT_CAP_SUBS_WRITE,
+			SND_SEQ_PORT_TYPE_MIDI_GENERIC | SND_SEQ_PORT_TYPE_APPLICATION);
+	queue = snd_seq_alloc_named_queue(seq, clientName);
+	if (port < 0 || queue < 0) {
+		printf("Failed to create MIDI port: %s\n",
+				snd_strerror(port < 0 ? port : queue));
+		snd_seq_close(seq);
+		seq = nullptr;
+		return false;
+	}
+
+	// have the sequencer stamp events with real time as they arrive on
+	// the port, counted from when the queue was started
+	snd_seq_port_info_t *info;
+	snd_seq_port_info_alloca(&info);
+	snd_seq_get_port_info(seq, port, info);
+	snd_seq_port_info_set_timestamping(info, 1);
+	snd_seq_port_info_set_timestamp_real(info, 1);
+	snd_seq_port_info_set_timestamp_queue(info, queue);
+	snd_seq_set_port_info(seq, port, info);
+
+	snd_seq_start_queue(seq, queue, nullptr);
+	snd_seq_drain_output(seq);
+	origin = clock->getElapsedTime();
+
+	snd_seq_nonblock(seq, 1);
+
+	printf("MIDI input on %d:%d\n", snd_seq_client_id(seq), port);
+	reader = std::thread(&MidiInput::run, this);
+	return true;
+}
+
+void MidiInput::run()
+{
+	profiler::SetThreadName("midi");
+	const int fdCount = snd_seq_poll_descriptors_count(seq, POLLIN);
+	std::vector<struct pollfd> fds(fdCount);
+	snd_seq_poll_descriptors(seq, fds.data(), fdCount, POLLIN);
+
+	while (!quit) {
+		// wake up every now and then to notice quit
+		if (poll(fds.data(), fdCount, 100) <= 0)
+			continue;
+		snd_seq_event_t *ev;
+		while (snd_seq_event_input(seq, &ev) >= 0)
+			handle(ev);
+	}
+}
+
+void MidiInput::handle(const snd_seq_event_t *ev)
+{
+	profiler::Zone zone(profiler::Zone_MidiEvent);
+	Event event;
+	if (ev->type == SND_SEQ_EVENT_NOTEON)
+		event.on = ev->data.note.velocity > 0;
+	else if (ev->type == SND_SEQ_EVENT_NOTEOFF)
+		event.on = false;
+	else
+		return;
+	event.pitch = ev->data.note.note;
+
+	const sf::Time now = clock->getElapsedTime();
+	event.stamp = now;
+	if (snd_seq_ev_is_real(ev)) {
+		event.stamp = origin + sf::microseconds(
+				(sf::Int64)ev->time.time.tv_sec*1000000 +
+				ev->time.time.tv_nsec/1000);
+		// the two clocks drift apart a little, never schedule ahead
+		if (event.stamp > now)
+			event.stamp = now;
+	}
+
+	Key *key = keyboard->LookupPitch(event.pitch);
+	if (!key)
+		return;
+	if (event.on)
+		key->KeyPressed(engine, event.stamp);
+	else
+		key->KeyReleased(engine, event.stamp);
+
+	std::lock_guard<std::mutex> lock(eventsMutex);
+	events.push_back(event);
+}
+
+void MidiInput::Collect(std::vector<Event> *out)
+{
+	std::lock_guard<std::mutex> lock(eventsMutex);
+	out->insert(out->end(), events.begin(), events.end());
+	events.clear();
+}
+
+MidiInput::~MidiInput()
+{
+	if (!seq)
+		return;
+	quit = true;
+	reader.join();
+	snd_seq_free_queue(seq, queue);
+	snd_seq_close(seq);
+}
+
@@ -0,0 +1,56 @@
+#ifndef MIDI_HH
+#define MIDI_HH
+
+#include "engine.hh"
+#include "keyboard.hh"
+
+#include <alsa/asoundlib.h>
+#include <SFML/System.hpp>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// An ALSA sequencer client with one writable port that anything can be
+// connected to, e.g. `aconnect <keyboard> sythin2:0` or
+// `aplaymidi -p sythin2:0 song.mid`. Note events are read on a thread of
+// their own and go to the engine straight away, through the key playing
+// the same pitch. Each event is stamped by the sequencer queue when it
+// arrives, so its timing is kept even if the thread gets to it late.
+// The main thread learns about the notes afterwards through Collect(),
+// for drawing and recording only.
+class MidiInput
+{
+public:
+	struct Event {
+		int pitch;
+		bool on;
+		sf::Time stamp;
+	};
+private:
+	Keyboard *keyboard;
+	Engine *engine;
+	const sf::Clock *clock;
+
+	snd_seq_t *seq;
+	int port, queue;
+	sf::Time origin;
+
+	std::thread reader;
+	std::atomic<bool> quit;
+
+	std::mutex eventsMutex;
+	std::vector<Event> events;
+
+	void run();
+	void handle(const snd_seq_event_t *ev);
+public:
+	MidiInput(Keyboard *nKeyboard, Engine *nEngine, const sf::Clock *nClock);
+	~MidiInput();
+
+	bool Open(const char *clientName);
+	void Collect(std::vector<Event> *out);
+};
+
+#endif
+
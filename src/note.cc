@@ -1,6 +1,9 @@
 #include "constants.hh"
 #include "note.hh"
 #include "conv.hh"
+#include "profiler.hh"
+
+#include <algorithm>
 
 Note::Note()
 {
@@ -40,28 +43,31 @@ Note::Note(note::Name nName, int nOctave)
 	octave = nOctave;
 }
 
-void Note::GenerateSamples(Script *script)
+// MIDI note number, C4 being 60
+int Note::Pitch() const
+{
+	return (octave + 1)*12 + name;
+}
+
+void Note::GenerateSamples(Script *script, int volume, sf::Int16 *out) const
 {
-	sf::Int16 samples[Constants.maxSamples];
+	profiler::Zone zone(profiler::Zone_NoteSamples);
 	const double baseFrequency = conv::NoteNameToFreq(name, octave);
 	const double omega = 2*M_PI*baseFrequency;
 	unsigned long long int i = 0;
 	const double secondsPerSample = 1.0 / Constants.samplesPerSecond;
 	double t = 0;
 	while (i < Constants.maxSamples) {
-		const double value = Globals.volume*
-			script->GetValue(omega, t);
-		samples[i] = value;
-		t += secondsPerSample;
-		i++;
+		// timed in batches, a zone per sample would cost more than the call
+		profiler::Zone batch(profiler::Zone_ScriptValues);
+		const unsigned long long int batchEnd = std::min(Constants.maxSamples,
+				i + Constants.profiler.valuesBatch);
+		for (; i < batchEnd; i++) {
+			const double value = volume*
+				script->GetValue(omega, t);
+			out[i] = value;
+			t += secondsPerSample;
+		}
 	}
-
-	if (!soundBuffer.loadFromSamples(samples, i, Constants.channels,
-				Constants.samplesPerSecond)) {
-		puts("Failed to copy sound buffer");
-		throw;
-	}
-
-	sound.setBuffer(soundBuffer);
 }
 
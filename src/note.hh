@@ -2,7 +2,10 @@
 #define NOTE_HH
 
 #include <SFML/Audio.hpp>
+#include <memory>
+#include <vector>
 
+#include "arena.hh"
 #include "script.hh"
 
 namespace note {
@@ -24,11 +27,16 @@ enum Name {
 
 }
 
+// replaced as a whole on every compile, so voices that are still playing
+// the previous samples keep them alive until they finish
+typedef std::shared_ptr<const SampleBank> Samples;
+// a bank for every voice, as a patch switches them all at once
+typedef std::shared_ptr<const std::vector<Samples>> SampleSet;
+
 class Note
 {
-	sf::SoundBuffer soundBuffer;
 public:
-	sf::Sound sound;
+	Samples samples;
 
 	note::Name name;
 	char letter, accidental;
@@ -37,7 +45,9 @@ public:
 	Note();
 	Note(note::Name nName, int nOctave);
 
-	void GenerateSamples(Script *script);
+	int Pitch() const;
+	// Constants.maxSamples of them
+	void GenerateSamples(Script *script, int volume, sf::Int16 *out) const;
 };
 
 #endif
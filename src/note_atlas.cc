@@ -1,108 +1,67 @@
 #include "constants.hh"
-#include "conv.hh"
 #include "note_atlas.hh"
 
-static std::map<std::string, sf::IntRect> positions;
+#include <cstdio>
 
-bool note_atlas::CreateNoteTexture(sf::Font &font, sf::Texture *texture)
-{
-	struct noteSymbol { char letter, accidental; int octave; };
-	std::vector<noteSymbol> noteNames;
-	for (int i = 0; i < Constants.noteAtlas.precomputedOctaves; i++) {
-		noteNames.push_back({ 'A', ' ', i+1 });
-		noteNames.push_back({ 'A', '#', i+1 });
-		noteNames.push_back({ 'B', ' ', i+1 });
-		noteNames.push_back({ 'C', ' ', i+1 });
-		noteNames.push_back({ 'C', '#', i+1 });
-		noteNames.push_back({ 'D', ' ', i+1 });
-		noteNames.push_back({ 'D', '#', i+1 });
-		noteNames.push_back({ 'E', ' ', i+1 });
-		noteNames.push_back({ 'F', ' ', i+1 });
-		noteNames.push_back({ 'F', '#', i+1 });
-		noteNames.push_back({ 'G', ' ', i+1 });
-		noteNames.push_back({ 'G', '#', i+1 });
-	}
-
-	sf::Text text;
-	text.setFont(font);
-	text.setCharacterSize(Constants.text.size);
-
-	sf::Color textColor = conv::HSVtoRGB(0, 0, Constants.text.colorValue),
-		background = conv::HSVtoRGB(0, 0, Constants.text.backgroundValue);
-
-	sf::RenderTexture textRT;
-	if (!textRT.create(Constants.noteAtlas.width, Constants.noteAtlas.height))
-		return false;
-	textRT.clear(background);
-
-	int counterX = 0;
-
-	for (auto &note : noteNames) {
-		int textureSegmentWidth = 0;
-		text.setString(note.letter);
-		textureSegmentWidth += text.getLocalBounds().width;
-		if (note.accidental != ' ') {
-			text.setString(note.accidental);
-			textureSegmentWidth += text.getLocalBounds().width;
-			textureSegmentWidth += Constants.text.spacing;
-		}
-		text.setString(std::to_string(note.octave));
-		textureSegmentWidth += text.getLocalBounds().width;
-		textureSegmentWidth += Constants.text.spacing;
-		int textureSegmentHeight = text.getLocalBounds().height;
-
-		text.setString(note.letter);
-		auto rect = text.getLocalBounds();
-		text.setPosition(-rect.left, -rect.top);
-		text.move(counterX, 0);
+static struct {
+	bool present;
+	sf::FloatRect quad, texRect;
+} glyphs[128];
 
-		text.setColor(textColor);
-		textRT.draw(text);
+static const char letters[12] = {
+	'C', 'C', 'D', 'D', 'E', 'F', 'F', 'G', 'G', 'A', 'A', 'B'
+};
+static const bool sharps[12] = {
+	false, true, false, true, false, false, true, false, true, false, true, false
+};
 
-		int xof = 0;
-		if (note.accidental != ' ') {
-			text.setString(note.accidental);
-			auto thisRect = text.getLocalBounds();
-			text.setPosition(-thisRect.left, -thisRect.top);
-			xof = rect.width + Constants.text.spacing;
-			text.move(xof, 0);
-			text.move(counterX, 0);
-
-			text.setColor(textColor);
-			textRT.draw(text);
-
-			rect = text.getLocalBounds();
-		}
-
-		text.setString(std::to_string(note.octave));
-		auto thisRect = text.getLocalBounds();
-		text.setPosition(-thisRect.left, -thisRect.top);
-		text.move(xof + rect.width + Constants.text.spacing, 0);
-		text.move(counterX, 0);
-
-		text.setColor(textColor);
-		textRT.draw(text);
-
-		textRT.display();
-
-		std::string noteStr = "";
-		noteStr += note.letter;
-		noteStr += note.accidental;
-		noteStr += std::to_string(note.octave);
-		positions[noteStr] =
-			sf::IntRect(counterX, 0, textureSegmentWidth, textureSegmentHeight);
-		counterX += textureSegmentWidth;
+// the glyphs are copied out of the font into a table indexed by character
+void note_atlas::Init(const ImFont *labelFont, sf::Vector2u atlasSize)
+{
+	for (int c = 0; c < 128; c++) {
+		glyphs[c].present = false;
+		const ImFont::Glyph *glyph = labelFont->FindGlyph(c);
+		if (!glyph || glyph == labelFont->FallbackGlyph)
+			continue;
+		glyphs[c].present = true;
+		glyphs[c].quad = sf::FloatRect(glyph->X0, glyph->Y0,
+				glyph->X1 - glyph->X0, glyph->Y1 - glyph->Y0);
+		glyphs[c].texRect = sf::FloatRect(
+				glyph->U0*atlasSize.x, glyph->V0*atlasSize.y,
+				(glyph->U1 - glyph->U0)*atlasSize.x,
+				(glyph->V1 - glyph->V0)*atlasSize.y);
 	}
-	*texture = textRT.getTexture();
-	return true;
 }
 
-sf::IntRect note_atlas::LookupNotePosition(char letter, char accidental, int octave)
+note_atlas::Label note_atlas::LookupLabel(note::Name name, int octave)
 {
-	std::string noteStr = "";
-	noteStr += letter;
-	noteStr += accidental;
-	noteStr += std::to_string(octave);
-	return positions[noteStr];
+	char text[maxLabelGlyphs + 1];
+	int length = snprintf(text, sizeof(text), "%c%s%d", letters[name],
+			sharps[name] ? "#" : "", octave);
+	if (length > maxLabelGlyphs)
+		length = maxLabelGlyphs;
+
+	Label label;
+	label.glyphCount = 0;
+	float x = 0, top = 0, bottom = 0;
+	for (int i = 0; i < length; i++) {
+		const auto &glyph = glyphs[(int)text[i]];
+		if (!glyph.present)
+			continue;
+		const float glyphBottom = glyph.quad.top + glyph.quad.height;
+		if (label.glyphCount == 0 || glyph.quad.top < top)
+			top = glyph.quad.top;
+		if (label.glyphCount == 0 || glyphBottom > bottom)
+			bottom = glyphBottom;
+		label.quads[label.glyphCount] = sf::FloatRect(x, glyph.quad.top,
+				glyph.quad.width, glyph.quad.height);
+		label.texRects[label.glyphCount] = glyph.texRect;
+		label.glyphCount++;
+		x += glyph.quad.width + Constants.text.spacing;
+	}
+	for (int i = 0; i < label.glyphCount; i++)
+		label.quads[i].top -= top;
+	label.size = sf::Vector2f(x - Constants.text.spacing, bottom - top);
+	return label;
 }
 
@@ -1,16 +1,34 @@
 #ifndef NOTE_ATLAS_HH
 #define NOTE_ATLAS_HH
 
+#include "note.hh"
+
 #include <SFML/Graphics.hpp>
-#include <map>
-#include <memory>
-#include <vector>
+#include "../imgui/imgui.h"
 
+// Note labels are put together from the glyphs of the label font, which
+// lives in the same atlas texture as the GUI font, so there is a label
+// for every octave and the keyboard samples the texture ImGui does.
+// The glyphs are baked at build time along with the rest of the atlas
+// (make font-atlas), so they come out of the executable rather than a
+// second texture or glyph table of their own.
 namespace note_atlas {
 
-bool CreateNoteTexture(sf::Font &font, sf::Texture *texture);
+// letter, sharp, sign and digits of any int fit
+const int maxLabelGlyphs = 14;
+
+struct Label {
+	int glyphCount;
+	// positions relative to the top left corner of the label
+	sf::FloatRect quads[maxLabelGlyphs];
+	// in texels of the atlas
+	sf::FloatRect texRects[maxLabelGlyphs];
+	sf::Vector2f size;
+};
+
+void Init(const ImFont *labelFont, sf::Vector2u atlasSize);
 
-sf::IntRect LookupNotePosition(char letter, char accidental, int octave);
+Label LookupLabel(note::Name name, int octave);
 
 }
 
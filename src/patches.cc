@@ -0,0 +1,154 @@
+#include "patches.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <dirent.h>
+#include <memory>
+
+PatchLibrary::PatchLibrary()
+{
+	active = 0;
+	wanted = -1;
+}
+
+void PatchLibrary::Scan(const char *directory, Compiler *compiler,
+		SampleCache *cache, size_t voices)
+{
+	for (size_t i = 1; i < patches.size(); i++)
+		compiler->UnpinBanks(patches[i].filename);
+	patches.clear();
+	Patch wave;
+	wave.name = "wave";
+	wave.filename = "wave.lua";
+	wave.preloaded = true;
+	wave.loading = false;
+	patches.push_back(wave);
+	active = 0;
+	wanted = -1;
+	cache->Truncate(1);
+
+	DIR *dir = opendir(directory);
+	if (!dir)
+		return;
+	std::vector<std::string> names;
+	while (struct dirent *entry = readdir(dir)) {
+		const std::string name = entry->d_name;
+		if (name.size() > 4 && name[0] != '.' &&
+				name.compare(name.size() - 4, 4, ".lua") == 0)
+			names.push_back(name);
+	}
+	closedir(dir);
+	std::sort(names.begin(), names.end());
+
+	for (auto &name : names) {
+		Patch patch;
+		patch.name = name.substr(0, name.size() - 4);
+		patch.filename = std::string(directory) + "/" + name;
+		patch.preloaded = false;
+		patch.loading = false;
+		patch.volume = 0;
+		patch.compressed = false;
+		compiler->PinBanks(patch.filename,
+				Compiler::ScriptKeyOf(patch.filename));
+		cache->Invalidate(patches.size(), voices);
+		patches.push_back(patch);
+	}
+}
+
+void PatchLibrary::Preload(Compiler *compiler, const std::vector<Note> &notes,
+		const std::vector<int> &voices, int volume, bool compressed)
+{
+	for (size_t i = 1; i < patches.size(); i++) {
+		Patch &patch = patches[i];
+		if (patch.preloaded || patch.loading)
+			continue;
+		compiler->Preload(patch.filename.c_str(), notes, voices, volume,
+				compressed);
+		patch.loading = true;
+		patch.volume = volume;
+		patch.compressed = compressed;
+		patch.error.clear();
+	}
+}
+
+void PatchLibrary::Render(Compiler *compiler, int index,
+		const std::vector<Note> &notes, const std::vector<int> &voices)
+{
+	if (index <= 0 || index >= (int)patches.size() || voices.empty())
+		return;
+	const Patch &patch = patches[index];
+	compiler->RenderPatch(patch.filename.c_str(), notes, voices, patch.volume,
+			patch.compressed);
+}
+
+// results of a Scan() before the last one find nothing to go to
+bool PatchLibrary::Loaded(const Compiler::Result &result, SampleCache *cache,
+		int *index)
+{
+	if (result.patch.empty())
+		return false;
+	*index = -1;
+	for (size_t i = 1; i < patches.size(); i++) {
+		Patch &patch = patches[i];
+		if (patch.filename != result.patch)
+			continue;
+		// a render that fails after the preload still shows, and the keys
+		// it was for are asked for again the next time they are played
+		patch.error = result.error;
+		if (patch.loading) {
+			patch.loading = false;
+			patch.preloaded = result.error.empty();
+		}
+		if (!result.error.empty()) {
+			cache->Retry(i);
+			break;
+		}
+		for (size_t n = 0; n < result.voices.size(); n++)
+			cache->Insert(i, result.voices[n], result.samples[n]);
+		*index = i;
+		break;
+	}
+	return true;
+}
+
+size_t PatchLibrary::Count() const
+{
+	return patches.size();
+}
+
+const PatchLibrary::Patch& PatchLibrary::Get(int index) const
+{
+	return patches[index];
+}
+
+int PatchLibrary::Active() const
+{
+	return active;
+}
+
+void PatchLibrary::SetActive(int index)
+{
+	active = index;
+}
+
+void PatchLibrary::Select(int index)
+{
+	if (index >= 0 && index < (int)patches.size())
+		wanted = index;
+}
+
+int PatchLibrary::TakeReady()
+{
+	if (wanted < 0)
+		return -1;
+	const Patch &patch = patches[wanted];
+	if (!patch.preloaded) {
+		if (!patch.loading)
+			wanted = -1;
+		return -1;
+	}
+	const int ready = wanted;
+	wanted = -1;
+	return ready;
+}
+
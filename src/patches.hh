@@ -0,0 +1,63 @@
+#ifndef PATCHES_HH
+#define PATCHES_HH
+
+#include "cache.hh"
+#include "compiler.hh"
+#include "note.hh"
+
+#include <string>
+#include <vector>
+
+// The wave scripts that can be switched between while playing: wave.lua,
+// the one in the editor, first, then every script in the patches
+// directory. Their banks are all kept by SampleCache, under the index of
+// the patch, and count against the same cap. Every patch but wave.lua is
+// preloaded by the compiler with the keys on screen, so switching to it
+// only hands those banks to the engine; the rest are rendered once they
+// are played, like those of wave.lua.
+// Only ever touched from the main thread.
+class PatchLibrary
+{
+public:
+	struct Patch {
+		std::string name, filename;
+		bool preloaded, loading;
+		std::string error;
+		// what it was preloaded with, later banks are rendered the same
+		int volume;
+		bool compressed;
+	};
+private:
+	std::vector<Patch> patches;
+	int active, wanted;
+public:
+	PatchLibrary();
+
+	// forgets every bank of a patch in cache, and pins those of the
+	// patches found in the disk cache of the compiler instead of those
+	// of the patches found before
+	void Scan(const char *directory, Compiler *compiler, SampleCache *cache,
+			size_t voices);
+	// whatever isn't preloaded or being preloaded yet
+	void Preload(Compiler *compiler, const std::vector<Note> &notes,
+			const std::vector<int> &voices, int volume, bool compressed);
+	// keys of a patch other than wave.lua that were played without banks
+	void Render(Compiler *compiler, int index, const std::vector<Note> &notes,
+			const std::vector<int> &voices);
+	// false if result isn't from a patch; its banks go into cache, and
+	// index is the patch they are of, or -1 if it's gone since
+	bool Loaded(const Compiler::Result &result, SampleCache *cache,
+			int *index);
+
+	size_t Count() const;
+	const Patch& Get(int index) const;
+	int Active() const;
+	void SetActive(int index);
+	// switched to as soon as it's preloaded
+	void Select(int index);
+	// the patch selected last, once it can be switched to; -1 otherwise
+	int TakeReady();
+};
+
+#endif
+
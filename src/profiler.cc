@@ -0,0 +1,273 @@
+#include "profiler.hh"
+#include "constants.hh"
+#include "ring.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+
+namespace profiler {
+
+static const char *zoneNames[ZoneCount] = {
+	"poll events",
+	"build frame",
+	"ImGui::Render",
+	"keyboard draw",
+	"audio block",
+	"wave script",
+	"note samples",
+	"script values",
+	"midi event",
+	"disk io",
+	"lua gc",
+};
+
+static const char *counterNames[CounterCount] = {
+	"voices",
+	"output ring",
+	"lua heap",
+};
+
+struct ThreadBuffer {
+	std::string name;
+	SpscRing<Record> ring;
+	std::atomic<int> dropped;
+
+	ThreadBuffer(const std::string &nName)
+		: name(nName), ring(Constants.profiler.ringRecords) {
+		dropped = 0;
+	}
+};
+
+// Buffers outlive their threads, there are only ever a handful.
+static std::mutex buffersMutex;
+static std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+static thread_local ThreadBuffer *buffer = nullptr;
+static thread_local const char *threadName = nullptr;
+
+std::atomic<bool> enabled(false);
+thread_local int depth = 0;
+static std::atomic<uint32_t> nextFlow(1);
+
+// Per zone, the last second split into a few periods; the stats are over
+// all of them, so they roll instead of jumping once a second.
+struct Period {
+	int calls;
+	int64_t total, max;
+};
+static Period periods[ZoneCount][4];
+static int currentPeriod = 0;
+static int64_t periodStart = 0;
+static ZoneStats stats[ZoneCount];
+static std::vector<ThreadStrip> strips;
+static std::vector<Record> drained;
+static int64_t lastCollected = 0;
+
+static FILE *trace = nullptr;
+static int64_t traceStart = 0;
+static size_t namedThreads = 0;
+
+int64_t Now()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SetThreadName(const char *name)
+{
+	threadName = name;
+}
+
+void SetEnabled(bool enable)
+{
+	enabled.store(enable, std::memory_order_relaxed);
+}
+
+static void push(const Record &record)
+{
+	if (!buffer) {
+		std::lock_guard<std::mutex> lock(buffersMutex);
+		buffers.emplace_back(new ThreadBuffer(threadName ? threadName :
+					"thread " + std::to_string(buffers.size())));
+		buffer = buffers.back().get();
+	}
+	if (buffer->ring.Push(&record, 1) == 0)
+		buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Submit(ZoneId zone, int64_t start, int zoneDepth)
+{
+	push(Record { Record::Kind_Zone, (uint16_t)zone, (uint16_t)zoneDepth,
+			start, Now() });
+}
+
+void Count(CounterId counter, int64_t value)
+{
+	if (enabled.load(std::memory_order_relaxed))
+		push(Record { Record::Kind_Counter, (uint16_t)counter, 0, Now(), value });
+}
+
+uint32_t FlowStart()
+{
+	if (!enabled.load(std::memory_order_relaxed))
+		return 0;
+	const uint32_t flow = nextFlow.fetch_add(1, std::memory_order_relaxed);
+	push(Record { Record::Kind_FlowStart, 0, 0, Now(), flow });
+	return flow;
+}
+
+void FlowEnd(uint32_t flow)
+{
+	if (flow != 0 && enabled.load(std::memory_order_relaxed))
+		push(Record { Record::Kind_FlowEnd, 0, 0, Now(), flow });
+}
+
+bool StartTrace(const char *filename)
+{
+	trace = fopen(filename, "wb");
+	if (!trace) {
+		printf("Failed to open \"%s\" for writing\n", filename);
+		return false;
+	}
+	traceStart = Now();
+	fprintf(trace, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+			"{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+			"\"args\":{\"name\":\"sythin2\"}}");
+	return true;
+}
+
+void StopTrace()
+{
+	if (!trace)
+		return;
+	Collect();
+	fprintf(trace, "\n]}\n");
+	if (ferror(trace))
+		puts("Failed to write the trace");
+	fclose(trace);
+	trace = nullptr;
+}
+
+// Chrome's trace event format; flows bind to the zone they are in on
+// either end
+static void writeEvent(const Record &record, int thread)
+{
+	const int64_t ts = record.start - traceStart;
+	switch (record.kind) {
+		case Record::Kind_Zone:
+			fprintf(trace, ",\n{\"name\":\"%s\",\"cat\":\"zone\",\"ph\":\"X\","
+					"\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%d}",
+					zoneNames[record.id], (long long)ts,
+					(long long)(record.end - record.start), thread);
+			break;
+		case Record::Kind_Counter:
+			fprintf(trace, ",\n{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%lld,"
+					"\"pid\":1,\"args\":{\"value\":%lld}}",
+					counterNames[record.id], (long long)ts, (long long)record.end);
+			break;
+		case Record::Kind_FlowStart:
+		case Record::Kind_FlowEnd:
+			fprintf(trace, ",\n{\"name\":\"command\",\"cat\":\"flow\","
+					"\"ph\":\"%s\",\"id\":%lld,\"ts\":%lld,\"pid\":1,\"tid\":%d}",
+					record.kind == Record::Kind_FlowStart ? "s" : "f\",\"bp\":\"e",
+					(long long)record.end, (long long)ts, thread);
+			break;
+	}
+}
+
+static void publish(int64_t now)
+{
+	const int periodCount = sizeof(periods[0])/sizeof(periods[0][0]);
+	const double seconds = periodCount*Constants.profiler.periodMilliseconds/1000.;
+	for (int z = 0; z < ZoneCount; z++) {
+		int calls = 0;
+		int64_t total = 0, max = 0;
+		for (auto &period : periods[z]) {
+			calls += period.calls;
+			total += period.total;
+			max = std::max(max, period.max);
+		}
+		stats[z].name = zoneNames[z];
+		stats[z].calls = calls;
+		stats[z].averageMicroseconds = calls ? (double)total/calls : 0;
+		stats[z].maxMicroseconds = max;
+		stats[z].percent = total/(seconds*1e6)*100;
+	}
+	currentPeriod = (currentPeriod + 1) % periodCount;
+	for (int z = 0; z < ZoneCount; z++)
+		periods[z][currentPeriod] = Period { 0, 0, 0 };
+	periodStart = now;
+}
+
+void Collect()
+{
+	const int64_t now = Now();
+	const int64_t stripStart = now - Constants.profiler.stripMilliseconds*1000;
+	std::lock_guard<std::mutex> lock(buffersMutex);
+	if (trace)
+		for (; namedThreads < buffers.size(); namedThreads++)
+			fprintf(trace, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+					"\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+					(int)namedThreads + 1, buffers[namedThreads]->name.c_str());
+	strips.resize(buffers.size());
+	drained.resize(Constants.profiler.ringRecords);
+	for (size_t b = 0; b < buffers.size(); b++) {
+		ThreadStrip &strip = strips[b];
+		strip.name = buffers[b]->name;
+		const size_t count = buffers[b]->ring.Pop(drained.data(), drained.size());
+		for (size_t i = 0; i < count; i++) {
+			const Record &record = drained[i];
+			if (trace)
+				writeEvent(record, b + 1);
+			if (record.kind != Record::Kind_Zone)
+				continue;
+			Period &period = periods[record.id][currentPeriod];
+			const int64_t duration = record.end - record.start;
+			period.calls++;
+			period.total += duration;
+			period.max = std::max(period.max, duration);
+			strip.records.push_back(record);
+		}
+		// records come in the order they ended, which is close enough to
+		// the order they started in for trimming
+		size_t old = 0;
+		while (old < strip.records.size() && strip.records[old].end < stripStart)
+			old++;
+		strip.records.erase(strip.records.begin(), strip.records.begin() + old);
+		strip.maxDepth = 0;
+		for (auto &record : strip.records)
+			strip.maxDepth = std::max(strip.maxDepth, (int)record.depth);
+	}
+	if (now - periodStart >= Constants.profiler.periodMilliseconds*1000)
+		publish(now);
+	lastCollected = now;
+}
+
+const ZoneStats* Stats()
+{
+	return stats;
+}
+
+const std::vector<ThreadStrip>& Strips()
+{
+	return strips;
+}
+
+int64_t LastCollected()
+{
+	return lastCollected;
+}
+
+int Dropped()
+{
+	std::lock_guard<std::mutex> lock(buffersMutex);
+	int dropped = 0;
+	for (auto &buffer : buffers)
+		dropped += buffer->dropped.load(std::memory_order_relaxed);
+	return dropped;
+}
+
+}
+
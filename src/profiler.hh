@@ -0,0 +1,114 @@
+#ifndef PROFILER_HH
+#define PROFILER_HH
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Scoped timers around the hot paths. Every thread records into a ring of
+// its own, created on its first record, so recording never takes a lock;
+// the GUI thread drains all of them in Collect(). While disabled a zone
+// costs a relaxed atomic load.
+// Besides zones there are counters and flows, which only end up in the
+// trace file written with StartTrace(): a flow is an arrow from where
+// something was issued to where it was handled, on any two threads.
+namespace profiler {
+
+enum ZoneId {
+	Zone_PollEvents,
+	Zone_BuildFrame,
+	Zone_ImGuiRender,
+	Zone_KeyboardDraw,
+	Zone_AudioBlock,
+	Zone_WaveScript,
+	Zone_NoteSamples,
+	Zone_ScriptValues,
+	Zone_MidiEvent,
+	Zone_DiskIo,
+	Zone_LuaGc,
+	ZoneCount
+};
+
+enum CounterId {
+	Counter_Voices,
+	Counter_OutputRing,
+	Counter_LuaHeap,
+	CounterCount
+};
+
+struct Record {
+	enum Kind : uint8_t {
+		Kind_Zone,
+		Kind_Counter,
+		Kind_FlowStart,
+		Kind_FlowEnd
+	} kind;
+	uint16_t id, depth;
+	int64_t start;
+	// the end of zones, the value of counters, the id of flows
+	int64_t end;
+};
+
+// what's shown of a zone, over the last second
+struct ZoneStats {
+	const char *name;
+	int calls;
+	double averageMicroseconds, maxMicroseconds;
+	// of the wall time, more than 100% when on several threads at once
+	double percent;
+};
+
+struct ThreadStrip {
+	std::string name;
+	std::vector<Record> records;
+	int maxDepth;
+};
+
+extern std::atomic<bool> enabled;
+
+int64_t Now();
+void Submit(ZoneId zone, int64_t start, int zoneDepth);
+void Count(CounterId counter, int64_t value);
+// 0 while disabled, which FlowEnd() ignores
+uint32_t FlowStart();
+void FlowEnd(uint32_t flow);
+void SetThreadName(const char *name);
+void SetEnabled(bool enable);
+
+// GUI thread only
+bool StartTrace(const char *filename);
+void StopTrace();
+void Collect();
+const ZoneStats* Stats();
+const std::vector<ThreadStrip>& Strips();
+int64_t LastCollected();
+int Dropped();
+
+extern thread_local int depth;
+
+class Zone
+{
+	ZoneId zone;
+	int64_t start;
+public:
+	explicit Zone(ZoneId nZone) {
+		zone = nZone;
+		start = -1;
+		if (enabled.load(std::memory_order_relaxed)) {
+			start = Now();
+			depth++;
+		}
+	}
+	~Zone() {
+		if (start < 0)
+			return;
+		depth--;
+		Submit(zone, start, depth);
+	}
+};
+
+}
+
+#endif
+
@@ -0,0 +1,91 @@
+#include "resources.hh"
+
+#include "../bzip2-1.0.6/bzlib.h"
+#include <cstdio>
+
+// The assembler pulls the file in as is. Paths are relative to the
+// directory the compiler is run from, which is the repository root.
+#define INCBIN(name, file) \
+	__asm__( \
+		".section .rodata\n" \
+		".global " #name "_data\n" \
+		".balign 16\n" \
+		#name "_data:\n" \
+		".incbin \"" file "\"\n" \
+		".global " #name "_end\n" \
+		#name "_end:\n" \
+		".byte 0\n" \
+		".previous\n"); \
+	extern "C" const unsigned char name##_data[], name##_end[]
+
+INCBIN(commeLightTtf, "res/CommeLight.ttf");
+INCBIN(fontAtlas, "res/font-atlas.bin");
+
+const resources::Span resources::commeLightTtf = {
+	commeLightTtf_data, (size_t)(commeLightTtf_end - commeLightTtf_data)
+};
+const resources::Span resources::fontAtlas = {
+	fontAtlas_data, (size_t)(fontAtlas_end - fontAtlas_data)
+};
+
+static void printBzipError(int bzerror);
+
+bool resources::Decompress(const Span &compressed, std::vector<char> *out)
+{
+	bz_stream stream = bz_stream();
+	int bzerror = BZ2_bzDecompressInit(&stream, 0, 0);
+	if (bzerror != BZ_OK) {
+		printBzipError(bzerror);
+		return false;
+	}
+	stream.next_in = (char*)compressed.data;
+	stream.avail_in = compressed.size;
+
+	// grown as needed instead of guessing the size up front
+	out->resize(compressed.size*4);
+	size_t produced = 0;
+	do {
+		if (produced == out->size())
+			out->resize(out->size()*2);
+		stream.next_out = out->data() + produced;
+		stream.avail_out = out->size() - produced;
+		bzerror = BZ2_bzDecompress(&stream);
+		produced = out->size() - stream.avail_out;
+	} while (bzerror == BZ_OK && (stream.avail_in > 0 || stream.avail_out == 0));
+	BZ2_bzDecompressEnd(&stream);
+
+	if (bzerror != BZ_STREAM_END) {
+		printBzipError(bzerror == BZ_OK ? BZ_UNEXPECTED_EOF : bzerror);
+		return false;
+	}
+	out->resize(produced);
+	return true;
+}
+
+static void printBzipError(int bzerror)
+{
+	puts("Error at decompressing resource:");
+	switch (bzerror) {
+		case BZ_CONFIG_ERROR:
+			puts("The library has been mis-compiled");
+			break;
+		case BZ_PARAM_ERROR:
+			puts("Parameter error at BZ2_bzDecompress");
+			break;
+		case BZ_MEM_ERROR:
+			puts("Insufficient memory available") ;
+			break;
+		case BZ_DATA_ERROR:
+			puts("A data integrity error was detected in the compressed data");
+			break;
+		case BZ_DATA_ERROR_MAGIC:
+			puts("The compressed data doesn't begin with the right bytes");
+			break;
+		case BZ_UNEXPECTED_EOF:
+			puts("The compressed data ends unexpectedly");
+			break;
+		default:
+			puts("Unhandled error code");
+	}
+}
+
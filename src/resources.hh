@@ -0,0 +1,28 @@
+#ifndef RESOURCES_HH
+#define RESOURCES_HH
+
+#include <cstddef>
+#include <vector>
+
+// Files from res/ linked into the executable as they are, see
+// resources.cc. They are read straight from the executable's read-only
+// data, nothing is decoded or copied at startup.
+namespace resources {
+
+struct Span {
+	const unsigned char *data;
+	size_t size;
+};
+
+extern const Span commeLightTtf;
+// the ImGui atlas of that font, baked by `make font-atlas`, see fontloader.cc
+extern const Span fontAtlas;
+
+// Large assets can be kept bzip2 compressed in res/ and unpacked when they
+// are needed, into out; nothing in res/ is big enough to need it yet
+bool Decompress(const Span &compressed, std::vector<char> *out);
+
+}
+
+#endif
+
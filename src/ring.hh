@@ -0,0 +1,67 @@
+#ifndef RING_HH
+#define RING_HH
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Single producer, single consumer ring buffer. Neither side ever waits
+// or allocates: Push() drops what doesn't fit and Pop() takes only what
+// is there. The capacity is rounded up to a power of two.
+// Pop() moves items out, so a slot holds no references once consumed and
+// whatever it held is let go of by the consumer.
+template <typename T>
+class SpscRing
+{
+	std::vector<T> buffer;
+	size_t mask;
+	// head is only written by the producer, tail only by the consumer
+	std::atomic<size_t> head, tail;
+public:
+	explicit SpscRing(size_t capacity) {
+		size_t size = 1;
+		while (size < capacity)
+			size *= 2;
+		buffer.resize(size);
+		mask = size - 1;
+		head = 0;
+		tail = 0;
+	}
+
+	size_t Push(const T *items, size_t count) {
+		const size_t h = head.load(std::memory_order_relaxed);
+		const size_t t = tail.load(std::memory_order_acquire);
+		const size_t space = buffer.size() - (h - t);
+		if (count > space)
+			count = space;
+		for (size_t i = 0; i < count; i++)
+			buffer[(h + i) & mask] = items[i];
+		head.store(h + count, std::memory_order_release);
+		return count;
+	}
+
+	size_t Pop(T *items, size_t count) {
+		const size_t t = tail.load(std::memory_order_relaxed);
+		const size_t h = head.load(std::memory_order_acquire);
+		if (count > h - t)
+			count = h - t;
+		for (size_t i = 0; i < count; i++)
+			items[i] = std::move(buffer[(t + i) & mask]);
+		tail.store(t + count, std::memory_order_release);
+		return count;
+	}
+
+	// exact on either side, a snapshot from anywhere else
+	size_t Size() const {
+		return head.load(std::memory_order_acquire) -
+			tail.load(std::memory_order_acquire);
+	}
+
+	size_t Capacity() const {
+		return buffer.size();
+	}
+};
+
+#endif
+
@@ -0,0 +1,159 @@
+#include "scope.hh"
+#include "constants.hh"
+
+#include <algorithm>
+#include <cmath>
+
+Scope::Scope()
+{
+	size = Constants.scope.historySamples;
+	levelCount = 0;
+	while ((size_t)1 << levelCount < size)
+		levelCount++;
+	levels.resize(levelCount + 1);
+	for (int level = 0; level <= levelCount; level++)
+		levels[level].assign(size >> level, Bin { 0, 0 });
+	written = 0;
+
+	incoming.resize(Constants.audio.blockSize*8);
+	audible = false;
+
+	const int fftSize = Constants.scope.fftSize;
+	fft.resize(fftSize);
+	window.resize(fftSize);
+	for (int i = 0; i < fftSize; i++)
+		window[i] = 0.5f - 0.5f*cos(2*M_PI*i/(fftSize - 1));
+	magnitudes.resize(fftSize/2);
+	spectrumWritten = 0;
+}
+
+// the first sample to land in a bin resets it, so bins never mix in what
+// was there a lap ago
+void Scope::append(float sample)
+{
+	for (int level = 0; level <= levelCount; level++) {
+		Bin &bin = levels[level][(written >> level) & ((size >> level) - 1)];
+		if ((written & (((uint64_t)1 << level) - 1)) == 0) {
+			bin.min = sample;
+			bin.max = sample;
+		} else {
+			bin.min = std::min(bin.min, sample);
+			bin.max = std::max(bin.max, sample);
+		}
+	}
+	written++;
+}
+
+bool Scope::Pull(SpscRing<float> *ring)
+{
+	bool anySound = false, anything = false;
+	size_t count;
+	while ((count = ring->Pop(incoming.data(), incoming.size())) > 0) {
+		anything = true;
+		for (size_t i = 0; i < count; i++) {
+			anySound |= incoming[i] != 0;
+			append(incoming[i]);
+		}
+	}
+	// silence is drawn once after sound stops, then left alone
+	const bool changed = anything && (anySound || audible);
+	if (anything)
+		audible = anySound;
+	return changed;
+}
+
+size_t Scope::GetSize() const
+{
+	return size;
+}
+
+void Scope::Columns(size_t windowSamples, int columns, float *mins,
+		float *maxs) const
+{
+	// half the history at most, the rest may be halfway overwritten
+	windowSamples = std::min(windowSamples, size/2);
+	windowSamples = std::max(windowSamples, (size_t)columns);
+	const double perColumn = windowSamples/(double)columns;
+	int level = 0;
+	while (level < levelCount && (double)((uint64_t)2 << level) <= perColumn)
+		level++;
+
+	const uint64_t first = written > windowSamples ? written - windowSamples : 0;
+	const uint64_t mask = (size >> level) - 1;
+	for (int c = 0; c < columns; c++) {
+		const uint64_t from = first + (uint64_t)(c*perColumn),
+			to = std::max(from + 1, first + (uint64_t)((c + 1)*perColumn));
+		if (to > written) {
+			mins[c] = maxs[c] = 0;
+			continue;
+		}
+		float lo = levels[level][(from >> level) & mask].min,
+			hi = levels[level][(from >> level) & mask].max;
+		for (uint64_t b = (from >> level) + 1; b <= (to - 1) >> level; b++) {
+			lo = std::min(lo, levels[level][b & mask].min);
+			hi = std::max(hi, levels[level][b & mask].max);
+		}
+		mins[c] = lo;
+		maxs[c] = hi;
+	}
+}
+
+// in-place iterative radix-2
+void Scope::transform()
+{
+	const size_t n = fft.size();
+	for (size_t i = 1, j = 0; i < n; i++) {
+		size_t bit = n >> 1;
+		for (; j & bit; bit >>= 1)
+			j ^= bit;
+		j ^= bit;
+		if (i < j)
+			std::swap(fft[i], fft[j]);
+	}
+	for (size_t length = 2; length <= n; length <<= 1) {
+		const std::complex<float> step = std::polar(1.f, (float)(-2*M_PI/length));
+		for (size_t start = 0; start < n; start += length) {
+			std::complex<float> w = 1;
+			for (size_t k = 0; k < length/2; k++) {
+				const std::complex<float> even = fft[start + k],
+					odd = w*fft[start + k + length/2];
+				fft[start + k] = even + odd;
+				fft[start + k + length/2] = even - odd;
+				w *= step;
+			}
+		}
+	}
+}
+
+void Scope::Spectrum(int columns, float minHz, float *decibels)
+{
+	const size_t n = fft.size();
+	// only transformed again once there is something new
+	if (written != spectrumWritten) {
+		spectrumWritten = written;
+		for (size_t i = 0; i < n; i++) {
+			const uint64_t index = written - n + i;
+			const float sample = written >= n ? levels[0][index & (size - 1)].min : 0;
+			fft[i] = sample*window[i];
+		}
+		transform();
+		// a full scale sine through the Hann window peaks at n/4
+		for (size_t i = 0; i < n/2; i++)
+			magnitudes[i] = std::abs(fft[i])/(n/4);
+	}
+
+	const float nyquist = Constants.samplesPerSecond/2.f;
+	const float binHz = Constants.samplesPerSecond/(float)n;
+	for (int c = 0; c < columns; c++) {
+		const float fromHz = minHz*pow(nyquist/minHz, c/(float)columns),
+			toHz = minHz*pow(nyquist/minHz, (c + 1)/(float)columns);
+		size_t from = fromHz/binHz, to = toHz/binHz;
+		from = std::min(from, n/2 - 1);
+		to = std::min(std::max(to, from), n/2 - 1);
+		float peak = 0;
+		for (size_t b = from; b <= to; b++)
+			peak = std::max(peak, magnitudes[b]);
+		decibels[c] = 20*log10(std::max(peak, 1e-9f));
+	}
+}
+
@@ -0,0 +1,48 @@
+#ifndef SCOPE_HH
+#define SCOPE_HH
+
+#include "ring.hh"
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+// The last second and a half of output, kept on the GUI thread for the
+// oscilloscope and the spectrum. Next to the samples there is a min/max
+// pyramid: level k holds the extremes of every 2^k samples, so a column
+// of the oscilloscope never needs more than a few bins at whatever zoom.
+class Scope
+{
+	struct Bin {
+		float min, max;
+	};
+
+	size_t size;
+	int levelCount;
+	std::vector<std::vector<Bin>> levels;
+	uint64_t written;
+
+	std::vector<float> incoming;
+	bool audible;
+
+	std::vector<std::complex<float>> fft;
+	std::vector<float> window, magnitudes;
+	uint64_t spectrumWritten;
+
+	void append(float sample);
+	void transform();
+public:
+	Scope();
+
+	// drains the ring; false if nothing changed that's worth a redraw
+	bool Pull(SpscRing<float> *ring);
+
+	size_t GetSize() const;
+	// extremes of the latest windowSamples samples, split into columns
+	void Columns(size_t windowSamples, int columns, float *mins, float *maxs) const;
+	// decibels on a logarithmic frequency axis from minHz to Nyquist
+	void Spectrum(int columns, float minHz, float *decibels);
+};
+
+#endif
+
@@ -1,17 +1,138 @@
 #include "script.hh"
+#include "constants.hh"
+#include "profiler.hh"
+
+#include <algorithm>
+#include <cstdlib>
+
+static const size_t blockSizes[] = { 16, 32, 64, 128, 256 };
 
 Script::Script()
 {
-	L = luaL_newstate();
+	for (auto &list : freeBlocks)
+		list = nullptr;
+	chunkUsed = Constants.script.poolChunkBytes;
+	heapBytes = peakBytes = 0;
+	allocations = frees = reallocations = 0;
+	forcedCollections = idleSteps = 0;
+	garbage = false;
+
+	L = lua_newstate(allocate, this);
+	lua_gc(L, LUA_GCSTOP, 0);
 	luaL_openlibs(L);
+	heapLimit = heapBytes + Constants.script.garbageBytes;
+}
+
+int Script::sizeClassOf(size_t size)
+{
+	for (int c = 0; c < sizeClassCount; c++)
+		if (size <= blockSizes[c])
+			return c;
+	return -1;
+}
+
+// Lua passes the size of the old block along, which is all there is to
+// tell which pool it came from. A block is never smaller than the class
+// of the size it is known by, so one that can't be moved when it shrinks
+// just stays where it is, and is known by its new size from then on: Lua
+// doesn't allow a shrink to fail. A malloc block that ends up in a pool
+// that way is never given back, which only happens once memory has run
+// out anyway.
+void* Script::allocate(void *ud, void *ptr, size_t osize, size_t nsize)
+{
+	Script *script = (Script*)ud;
+	if (!ptr)
+		osize = 0;
+	if (nsize == 0) {
+		if (ptr) {
+			script->release(ptr, osize);
+			script->frees++;
+			script->heapBytes -= osize;
+		}
+		return nullptr;
+	}
+
+	const int oldClass = ptr ? sizeClassOf(osize) : -1,
+		newClass = sizeClassOf(nsize);
+	void *block;
+	if (ptr && oldClass == newClass)
+		block = newClass < 0 ? realloc(ptr, nsize) : ptr;
+	else {
+		block = newClass < 0 ? malloc(nsize) : script->poolAllocate(newClass);
+		if (block && ptr) {
+			memcpy(block, ptr, std::min(osize, nsize));
+			script->release(ptr, osize);
+		}
+	}
+	if (!block && ptr && nsize <= osize)
+		block = ptr;
+	if (!block)
+		return nullptr;
+	if (ptr)
+		script->reallocations++;
+	else
+		script->allocations++;
+	script->heapBytes += nsize - osize;
+	script->peakBytes = std::max(script->peakBytes, script->heapBytes);
+	script->garbage = true;
+	return block;
+}
+
+void* Script::poolAllocate(int sizeClass)
+{
+	if (void *block = freeBlocks[sizeClass]) {
+		freeBlocks[sizeClass] = *(void**)block;
+		return block;
+	}
+	const size_t size = blockSizes[sizeClass],
+		chunkBytes = Constants.script.poolChunkBytes;
+	if (chunkUsed + size > chunkBytes) {
+		char *chunk = (char*)malloc(chunkBytes);
+		if (!chunk)
+			return nullptr;
+		chunks.push_back(chunk);
+		chunkUsed = 0;
+	}
+	void *block = chunks.back() + chunkUsed;
+	chunkUsed += size;
+	return block;
+}
+
+void Script::poolFree(void *block, int sizeClass)
+{
+	*(void**)block = freeBlocks[sizeClass];
+	freeBlocks[sizeClass] = block;
+}
+
+void Script::release(void *block, size_t size)
+{
+	const int sizeClass = sizeClassOf(size);
+	if (sizeClass < 0)
+		free(block);
+	else
+		poolFree(block, sizeClass);
+}
+
+void Script::CollectIfOverLimit()
+{
+	if (heapBytes <= heapLimit)
+		return;
+	profiler::Zone zone(profiler::Zone_LuaGc);
+	lua_gc(L, LUA_GCCOLLECT, 0);
+	forcedCollections++;
+	garbage = false;
+	heapLimit = heapBytes + Constants.script.garbageBytes;
 }
 
-void Script::CopyAndExecute(const char *source)
+// named the way luaL_loadfile() names a file
+void Script::Execute(const std::string &text, const char *filename)
 {
-	int error = luaL_loadfile(L, source);
+	const std::string chunkName = std::string("@") + filename;
+	int error = luaL_loadbuffer(L, text.data(), text.size(), chunkName.c_str());
 	error |= lua_pcall(L, 0, LUA_MULTRET, 0);
 	if (error)
 		panic("failed to load file");
+	CollectIfOverLimit();
 }
 
 double Script::GetValue(double omega, double time)
@@ -30,6 +151,33 @@ double Script::GetValue(double omega, double time)
 	return result;
 }
 
+bool Script::IdleStep()
+{
+	if (!garbage)
+		return false;
+	profiler::Zone zone(profiler::Zone_LuaGc);
+	idleSteps++;
+	if (!lua_gc(L, LUA_GCSTEP, Constants.script.idleStepKilobytes))
+		return true;
+	garbage = false;
+	heapLimit = heapBytes + Constants.script.garbageBytes;
+	return false;
+}
+
+Script::MemoryStats Script::Stats() const
+{
+	MemoryStats stats;
+	stats.heapBytes = heapBytes;
+	stats.peakBytes = peakBytes;
+	stats.poolBytes = chunks.size()*Constants.script.poolChunkBytes;
+	stats.allocations = allocations;
+	stats.frees = frees;
+	stats.reallocations = reallocations;
+	stats.forcedCollections = forcedCollections;
+	stats.idleSteps = idleSteps;
+	return stats;
+}
+
 void Script::panic(std::string msg)
 {
 	const char *err = lua_tostring(L, -1);
@@ -49,5 +197,7 @@ void Script::panic(std::string msg)
 Script::~Script()
 {
 	lua_close(L);
+	for (char *chunk : chunks)
+		free(chunk);
 }
 
@@ -1,23 +1,65 @@
 #ifndef SCRIPT_HH
 #define SCRIPT_HH
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <cstring>
+#include <vector>
 #include "lua.hpp"
 
+// The Lua state gets its memory from pools of a few fixed block sizes,
+// carved out of chunks that are only freed with the state; anything
+// bigger goes to malloc. The collector is stopped for good, so it never
+// kicks in halfway through rendering a note: it runs in steps from
+// IdleStep(), and in full from CollectIfOverLimit(), called in between
+// notes, when the heap has grown by Constants.script.garbageBytes since
+// the last time it was collected.
 class Script
 {
+	static const int sizeClassCount = 5;
+
 	lua_State *L;
+	// a free list per size class, threaded through the free blocks
+	void *freeBlocks[sizeClassCount];
+	std::vector<char*> chunks;
+	size_t chunkUsed;
+
+	size_t heapBytes, peakBytes, heapLimit;
+	uint64_t allocations, frees, reallocations;
+	uint64_t forcedCollections, idleSteps;
+	// allocated since the collector last finished a cycle
+	bool garbage;
 
+	static int sizeClassOf(size_t size);
+	static void* allocate(void *ud, void *ptr, size_t osize, size_t nsize);
+	void* poolAllocate(int sizeClass);
+	void poolFree(void *block, int sizeClass);
+	void release(void *block, size_t size);
 	void panic(std::string msg);
 public:
+	struct MemoryStats {
+		size_t heapBytes, peakBytes;
+		// taken from malloc for the pools, only given back with the state
+		size_t poolBytes;
+		uint64_t allocations, frees, reallocations;
+		uint64_t forcedCollections, idleSteps;
+	};
+
 	std::string source;
 
 	Script();
 	~Script();
 
-	void CopyAndExecute(const char *source);
+	// text is the script, filename only what errors point at
+	void Execute(const std::string &text, const char *filename);
 	double GetValue(double omega, double time);
+	// never while a note is being rendered
+	void CollectIfOverLimit();
+
+	// true while there is more to collect
+	bool IdleStep();
+	MemoryStats Stats() const;
 };
 
 #endif
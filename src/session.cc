@@ -0,0 +1,225 @@
+#include "session.hh"
+#include "constants.hh"
+#include "profiler.hh"
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+// Header, then the script, the mappings and the events, each at an offset
+// that is a multiple of 8. The sizes of the records are in the header too,
+// a file written by a build where they differ is refused rather than read
+// wrong.
+static const char sessionMagic[4] = { 'S', 'Y', 'S', 'S' };
+static const uint32_t sessionVersion = 1;
+
+enum {
+	Section_Script,
+	Section_Mappings,
+	Section_Events,
+	Section_Count
+};
+
+struct Session::Header {
+	char magic[4];
+	uint32_t version;
+	uint32_t headerBytes, mappingBytes, eventBytes;
+	int32_t rows;
+	uint64_t fileBytes;
+	int32_t volume, bankCacheMegabytes;
+	uint32_t compressBanks, unused;
+	uint64_t bankScriptKey;
+	struct {
+		uint64_t offset, count;
+	} sections[Section_Count];
+};
+
+static size_t aligned(size_t offset)
+{
+	return (offset + 7) & ~(size_t)7;
+}
+
+Session::Session()
+{
+	mapping = nullptr;
+	mappingSize = 0;
+}
+
+Session::~Session()
+{
+	Unmap();
+}
+
+bool Session::Map(const char *filename)
+{
+	profiler::Zone zone(profiler::Zone_DiskIo);
+	Unmap();
+	const int fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		return false;
+	struct stat st;
+	if (fstat(fd, &st) || st.st_size < (off_t)sizeof(Header)) {
+		close(fd);
+		printf("Session \"%s\" is too short, ignoring it\n", filename);
+		return false;
+	}
+	void *address = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (address == MAP_FAILED) {
+		printf("Failed to map session \"%s\"\n", filename);
+		return false;
+	}
+	mapping = address;
+	mappingSize = st.st_size;
+
+	const Header *h = header();
+	const size_t recordBytes[Section_Count] = {
+		1, sizeof(Keyboard::Mapping), sizeof(Take::Event)
+	};
+	bool ok = !memcmp(h->magic, sessionMagic, sizeof(sessionMagic)) &&
+		h->version == sessionVersion && h->headerBytes == sizeof(Header) &&
+		h->mappingBytes == sizeof(Keyboard::Mapping) &&
+		h->eventBytes == sizeof(Take::Event) && h->fileBytes == mappingSize;
+	for (int i = 0; ok && i < Section_Count; i++) {
+		const uint64_t offset = h->sections[i].offset,
+			count = h->sections[i].count;
+		ok = offset % 8 == 0 && offset >= sizeof(Header) &&
+			offset <= mappingSize &&
+			count <= (mappingSize - offset)/recordBytes[i];
+	}
+	if (!ok) {
+		printf("Session \"%s\" wasn't written by this version, ignoring it\n",
+				filename);
+		Unmap();
+		return false;
+	}
+	return true;
+}
+
+void Session::Unmap()
+{
+	if (mapping)
+		munmap(mapping, mappingSize);
+	mapping = nullptr;
+	mappingSize = 0;
+}
+
+bool Session::IsMapped() const
+{
+	return mapping != nullptr;
+}
+
+const Session::Header* Session::header() const
+{
+	return (const Header*)mapping;
+}
+
+const void* Session::section(int index, size_t *count) const
+{
+	*count = header()->sections[index].count;
+	return (const char*)mapping + header()->sections[index].offset;
+}
+
+const char* Session::Script(size_t *size) const
+{
+	return (const char*)section(Section_Script, size);
+}
+
+const Keyboard::Mapping* Session::Mappings(size_t *count, int *rows) const
+{
+	*rows = header()->rows;
+	return (const Keyboard::Mapping*)section(Section_Mappings, count);
+}
+
+const Take::Event* Session::Events(size_t *count) const
+{
+	return (const Take::Event*)section(Section_Events, count);
+}
+
+int Session::Volume() const
+{
+	return header()->volume;
+}
+
+bool Session::CompressBanks() const
+{
+	return header()->compressBanks != 0;
+}
+
+int Session::BankCacheMegabytes() const
+{
+	return header()->bankCacheMegabytes;
+}
+
+uint64_t Session::BankScriptKey() const
+{
+	return header()->bankScriptKey;
+}
+
+// put together in memory, then written next to the real file and renamed
+// over it, like the font cache
+bool Session::Save(const char *filename, const std::string &script,
+		const Keyboard &keyboard, const Take &take, uint64_t bankScriptKey)
+{
+	profiler::Zone zone(profiler::Zone_DiskIo);
+	const std::vector<Keyboard::Mapping> mappings = keyboard.GetMappings();
+	const std::vector<Take::Event> &events = take.GetEvents();
+
+	Header h;
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, sessionMagic, sizeof(sessionMagic));
+	h.version = sessionVersion;
+	h.headerBytes = sizeof(Header);
+	h.mappingBytes = sizeof(Keyboard::Mapping);
+	h.eventBytes = sizeof(Take::Event);
+	h.rows = keyboard.KeysOnScreen()/12;
+	h.volume = Globals.volume;
+	h.bankCacheMegabytes = Globals.bankCacheMegabytes;
+	h.compressBanks = Globals.compressBanks;
+	h.bankScriptKey = bankScriptKey;
+
+	const void *data[Section_Count] = {
+		script.data(), mappings.data(), events.data()
+	};
+	const size_t sizes[Section_Count] = {
+		script.size(),
+		mappings.size()*sizeof(Keyboard::Mapping),
+		events.size()*sizeof(Take::Event)
+	};
+	const size_t counts[Section_Count] = {
+		script.size(), mappings.size(), events.size()
+	};
+	size_t end = sizeof(Header);
+	for (int i = 0; i < Section_Count; i++) {
+		h.sections[i].offset = aligned(end);
+		h.sections[i].count = counts[i];
+		end = h.sections[i].offset + sizes[i];
+	}
+	h.fileBytes = end;
+
+	std::vector<char> file(end, 0);
+	memcpy(file.data(), &h, sizeof(h));
+	for (int i = 0; i < Section_Count; i++)
+		if (sizes[i])
+			memcpy(file.data() + h.sections[i].offset, data[i], sizes[i]);
+
+	const std::string temporary = std::string(filename) + ".tmp";
+	FILE *f = fopen(temporary.c_str(), "wb");
+	if (!f) {
+		printf("Failed to save session \"%s\"\n", filename);
+		return false;
+	}
+	bool ok = fwrite(file.data(), 1, file.size(), f) == file.size();
+	ok = fclose(f) == 0 && ok;
+	if (!ok || rename(temporary.c_str(), filename)) {
+		remove(temporary.c_str());
+		printf("Failed to save session \"%s\"\n", filename);
+		return false;
+	}
+	return true;
+}
+
@@ -0,0 +1,52 @@
+#ifndef SESSION_HH
+#define SESSION_HH
+
+#include "keyboard.hh"
+#include "take.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Everything about a run worth coming back to: the script, the volume and
+// bank settings, the keymap and the recorded take, along with the key of
+// the script its banks sit in the disk cache under.
+// The file is laid out as it is used in memory, a header followed by
+// sections at aligned offsets, so loading it is one mmap and a check of
+// the header; the keymap and the take are read straight out of the
+// mapping. It is written once, at exit.
+class Session
+{
+	struct Header;
+
+	void *mapping;
+	size_t mappingSize;
+
+	const Header* header() const;
+	const void* section(int index, size_t *count) const;
+public:
+	Session();
+	~Session();
+
+	// false if there's no such file or it isn't a session this build wrote
+	bool Map(const char *filename);
+	void Unmap();
+	bool IsMapped() const;
+
+	// point into the mapping, valid until Unmap()
+	const char* Script(size_t *size) const;
+	const Keyboard::Mapping* Mappings(size_t *count, int *rows) const;
+	const Take::Event* Events(size_t *count) const;
+
+	int Volume() const;
+	bool CompressBanks() const;
+	int BankCacheMegabytes() const;
+	uint64_t BankScriptKey() const;
+
+	// with the settings in Globals
+	static bool Save(const char *filename, const std::string &script,
+			const Keyboard &keyboard, const Take &take, uint64_t bankScriptKey);
+};
+
+#endif
+
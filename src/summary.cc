@@ -0,0 +1,109 @@
+#include "summary.hh"
+
+#include <algorithm>
+#include <cmath>
+
+const size_t WaveSummary::headSamples;
+
+WaveSummary::WaveSummary()
+{
+	count = 0;
+}
+
+void WaveSummary::Build(const Samples &samples)
+{
+	count = samples ? samples->size() : 0;
+	head.clear();
+	levels.clear();
+	if (count == 0)
+		return;
+
+	// compressed banks are summarised as they will sound
+	std::vector<sf::Int16> decoded;
+	const sf::Int16 *data = samples->data();
+	if (!data) {
+		decoded.resize(count);
+		samples->Read(0, decoded.size(), decoded.data());
+		data = decoded.data();
+	}
+	head.assign(data, data + std::min(count, headSamples));
+	if (count < baseBin)
+		return;
+
+	std::vector<Bin> base(count/baseBin);
+	for (size_t b = 0; b < base.size(); b++) {
+		sf::Int16 lo = data[b*baseBin], hi = lo;
+		double squares = 0;
+		for (size_t i = b*baseBin; i < (b + 1)*baseBin; i++) {
+			lo = std::min(lo, data[i]);
+			hi = std::max(hi, data[i]);
+			squares += (double)data[i]*data[i];
+		}
+		base[b] = Bin { lo, hi, (float)sqrt(squares/baseBin) };
+	}
+	levels.push_back(std::move(base));
+
+	while (levels.back().size() >= 2) {
+		const std::vector<Bin> &below = levels.back();
+		std::vector<Bin> level(below.size()/2);
+		for (size_t b = 0; b < level.size(); b++) {
+			const Bin &l = below[2*b], &r = below[2*b + 1];
+			level[b] = Bin { std::min(l.min, r.min), std::max(l.max, r.max),
+				sqrtf((l.rms*l.rms + r.rms*r.rms)/2) };
+		}
+		levels.push_back(std::move(level));
+	}
+}
+
+float WaveSummary::Points(size_t windowSamples, int points, float *values) const
+{
+	windowSamples = std::min(windowSamples, count);
+	if (windowSamples == 0 || points <= 0) {
+		std::fill(values, values + 2*std::max(points, 0), 0.f);
+		return 0;
+	}
+
+	const double perPoint = windowSamples/(double)points;
+	int level = -1;
+	while (level + 1 < (int)levels.size() &&
+			(double)(baseBin << (level + 1)) <= perPoint)
+		level++;
+	// past the head, the base bins are as fine as it gets
+	if (level < 0 && windowSamples > head.size())
+		level = 0;
+
+	double squares = 0;
+	size_t squareCount = 0;
+	for (int p = 0; p < points; p++) {
+		const size_t from = p*perPoint,
+			to = std::max(from + 1, (size_t)((p + 1)*perPoint));
+		float lo, hi;
+		if (level < 0) {
+			// under a base bin per point, few enough samples to read the head
+			lo = hi = head[from];
+			for (size_t i = from; i < to; i++) {
+				lo = std::min(lo, (float)head[i]);
+				hi = std::max(hi, (float)head[i]);
+				squares += (double)head[i]*head[i];
+			}
+			squareCount += to - from;
+		} else {
+			const std::vector<Bin> &bins = levels[level];
+			const size_t binSize = baseBin << level;
+			const size_t first = std::min(from/binSize, bins.size() - 1),
+				last = std::min((to - 1)/binSize, bins.size() - 1);
+			lo = bins[first].min;
+			hi = bins[first].max;
+			for (size_t b = first; b <= last; b++) {
+				lo = std::min(lo, (float)bins[b].min);
+				hi = std::max(hi, (float)bins[b].max);
+				squares += (double)bins[b].rms*bins[b].rms;
+			}
+			squareCount += last - first + 1;
+		}
+		values[2*p] = lo;
+		values[2*p + 1] = hi;
+	}
+	return sqrt(squares/squareCount);
+}
+
@@ -0,0 +1,38 @@
+#ifndef SUMMARY_HH
+#define SUMMARY_HH
+
+#include "note.hh"
+
+#include <vector>
+
+// A min/max/RMS pyramid over the samples of one note, built once on the
+// compiler thread. Level k has a bin for every baseBin << k samples;
+// anything finer is read from a copy of the first headSamples samples.
+// The samples themselves aren't kept, so that a preview doesn't hold on
+// to the memory of a bank the cache has let go of.
+class WaveSummary
+{
+	struct Bin {
+		sf::Int16 min, max;
+		float rms;
+	};
+
+	size_t count;
+	std::vector<sf::Int16> head;
+	std::vector<std::vector<Bin>> levels;
+public:
+	static const size_t baseBin = 16;
+	// enough for Constants.gui.previewPoints under a base bin each
+	static const size_t headSamples = 1 << 13;
+
+	WaveSummary();
+
+	void Build(const Samples &samples);
+	// envelope of the first windowSamples samples at the given amount of
+	// points, alternating min and max so that one polyline fills it in;
+	// values is 2*points long. Returns the RMS over the window.
+	float Points(size_t windowSamples, int points, float *values) const;
+};
+
+#endif
+
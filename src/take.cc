@@ -0,0 +1,249 @@
+#include "take.hh"
+#include "constants.hh"
+
+#include <algorithm>
+
+static int bucketOf(double time)
+{
+	return std::max(0, (int)(time/Constants.take.bucketSeconds));
+}
+
+static int binOf(double time)
+{
+	return std::max(0, (int)(time/Constants.take.binSeconds));
+}
+
+Take::Take()
+{
+	Clear();
+}
+
+void Take::Clear()
+{
+	events.clear();
+	buckets.clear();
+	minPitch = maxPitch = -1;
+	density.clear();
+	for (int p = 0; p < pitchCount; p++)
+		openStart[p] = -1;
+	length = 0;
+}
+
+void Take::NoteOn(int pitch, double time)
+{
+	if (pitch < 0 || pitch >= pitchCount)
+		return;
+	if (openStart[pitch] >= 0)
+		NoteOff(pitch, time);
+	openStart[pitch] = time;
+	length = std::max(length, time);
+}
+
+void Take::NoteOff(int pitch, double time)
+{
+	if (pitch < 0 || pitch >= pitchCount || openStart[pitch] < 0)
+		return;
+	Event event { pitch, openStart[pitch], std::max(time, openStart[pitch]) };
+	openStart[pitch] = -1;
+	length = std::max(length, event.end);
+
+	events.push_back(event);
+	index(events.size() - 1);
+
+	if (minPitch < 0)
+		minPitch = maxPitch = pitch;
+	else if (pitch < minPitch || pitch > maxPitch)
+		widen(std::min(minPitch, pitch), std::max(maxPitch, pitch));
+	addDensity(event);
+}
+
+void Take::CloseOpenNotes(double time)
+{
+	for (int p = 0; p < pitchCount; p++)
+		NoteOff(p, time);
+}
+
+// events that can't have been recorded are left out; the pitch range is
+// known before the first one is counted, so the pyramid never widens
+void Take::Load(const Event *first, size_t count)
+{
+	Clear();
+	events.reserve(count);
+	for (size_t i = 0; i < count; i++) {
+		const Event &event = first[i];
+		if (event.pitch < 0 || event.pitch >= pitchCount ||
+				!(event.start >= 0) || !(event.end >= event.start))
+			continue;
+		events.push_back(event);
+		index(events.size() - 1);
+		minPitch = minPitch < 0 ? event.pitch : std::min(minPitch, event.pitch);
+		maxPitch = std::max(maxPitch, event.pitch);
+		length = std::max(length, event.end);
+	}
+	for (auto &event : events)
+		addDensity(event);
+}
+
+const std::vector<Take::Event>& Take::GetEvents() const
+{
+	return events;
+}
+
+void Take::index(uint32_t eventIndex)
+{
+	const Event &event = events[eventIndex];
+	int first = bucketOf(event.start), last = bucketOf(event.end);
+	size_t level = 0;
+	for (; first != last; level++) {
+		first /= 2;
+		last /= 2;
+	}
+	if (buckets.size() <= level)
+		buckets.resize(level + 1);
+	if ((int)buckets[level].size() <= first)
+		buckets[level].resize(first + 1);
+	buckets[level][first].push_back(eventIndex);
+}
+
+// an event overlapping [from, to] ends at or after from and starts at or
+// before to, and its bucket holds both ends
+void Take::Query(double from, double to, std::vector<const Event*> &out) const
+{
+	if (to < from)
+		return;
+	for (size_t level = 0; level < buckets.size(); level++) {
+		const int first = bucketOf(from) >> level;
+		const int last = std::min(bucketOf(to) >> level,
+				(int)buckets[level].size() - 1);
+		for (int b = first; b <= last; b++)
+			for (auto eventIndex : buckets[level][b]) {
+				const Event &event = events[eventIndex];
+				if (event.end >= from && event.start <= to)
+					out.push_back(&event);
+			}
+	}
+}
+
+void Take::addDensity(const Event &event)
+{
+	const int rows = maxPitch - minPitch + 1;
+	const int row = event.pitch - minPitch;
+	int first = binOf(event.start), last = binOf(event.end);
+
+	if (density.empty())
+		density.resize(1);
+	if ((int)density[0].size() < (last + 1)*rows)
+		density[0].resize((last + 1)*rows, 0);
+	for (int b = first; b <= last; b++) {
+		uint16_t &count = density[0][b*rows + row];
+		if (count < UINT16_MAX)
+			count++;
+	}
+
+	// coarser levels hold the maximum of their two children, so a block
+	// drawn from them is as dark as the densest spot it covers
+	for (size_t level = 1; ; level++) {
+		const int below = density[level - 1].size()/rows;
+		if (below <= 1)
+			break;
+		const bool created = density.size() <= level;
+		if (created)
+			density.resize(level + 1);
+		const int bins = (below + 1)/2;
+		if ((int)density[level].size() < bins*rows)
+			density[level].resize(bins*rows, 0);
+		first /= 2;
+		last /= 2;
+		if (created) {
+			for (int b = 0; b < bins; b++)
+				for (int r = 0; r < rows; r++)
+					reduce(level, b, r);
+		} else
+			for (int b = first; b <= last; b++)
+				reduce(level, b, row);
+	}
+}
+
+void Take::reduce(int level, int bin, int row)
+{
+	const int rows = maxPitch - minPitch + 1;
+	const int below = density[level - 1].size()/rows;
+	const int left = 2*bin, right = 2*bin + 1;
+	uint16_t value = density[level - 1][left*rows + row];
+	if (right < below)
+		value = std::max(value, density[level - 1][right*rows + row]);
+	density[level][bin*rows + row] = value;
+}
+
+// rows of the new pitches start out empty, everything else moves over
+void Take::widen(int lowest, int highest)
+{
+	const int rows = maxPitch - minPitch + 1, wider = highest - lowest + 1;
+	const int shift = minPitch - lowest;
+	for (auto &level : density) {
+		const int bins = level.size()/rows;
+		std::vector<uint16_t> widened(bins*wider, 0);
+		for (int b = 0; b < bins; b++)
+			std::copy(level.begin() + b*rows, level.begin() + (b + 1)*rows,
+					widened.begin() + b*wider + shift);
+		level.swap(widened);
+	}
+	minPitch = lowest;
+	maxPitch = highest;
+}
+
+size_t Take::GetEventCount() const
+{
+	return events.size();
+}
+
+double Take::GetLength() const
+{
+	return length;
+}
+
+double Take::GetOpenStart(int pitch) const
+{
+	return openStart[pitch];
+}
+
+bool Take::GetPitchRange(int *lowest, int *highest) const
+{
+	int low = minPitch, high = maxPitch;
+	for (int p = 0; p < pitchCount; p++)
+		if (openStart[p] >= 0) {
+			low = low < 0 ? p : std::min(low, p);
+			high = std::max(high, p);
+		}
+	if (low < 0)
+		return false;
+	*lowest = low;
+	*highest = high;
+	return true;
+}
+
+int Take::GetLevelCount() const
+{
+	return density.size();
+}
+
+double Take::GetBinWidth(int level) const
+{
+	return Constants.take.binSeconds*(1 << level);
+}
+
+int Take::GetBinCount(int level) const
+{
+	if (level >= (int)density.size())
+		return 0;
+	return density[level].size()/(maxPitch - minPitch + 1);
+}
+
+unsigned Take::GetDensity(int level, int bin, int pitch) const
+{
+	if (pitch < minPitch || pitch > maxPitch || bin < 0 ||
+			bin >= GetBinCount(level))
+		return 0;
+	return density[level][bin*(maxPitch - minPitch + 1) + pitch - minPitch];
+}
+
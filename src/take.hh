@@ -0,0 +1,69 @@
+#ifndef TAKE_HH
+#define TAKE_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Notes recorded in Writing mode. Besides the plain list of events a take
+// keeps two indices so views can be drawn in time proportional to what is
+// on screen rather than to the length of the take:
+// * an interval index: buckets of the base width, of twice that, of four
+//   times that and so on, and every event filed under the smallest one
+//   that holds all of it. A query only looks at the buckets it overlaps
+//   on every level, so however long a note is held it costs one look.
+// * a density pyramid: for every pitch and every power-of-two multiple of
+//   the base bin width, the amount of notes touching that bin. A wider
+//   pitch range moves what is there over rather than counting it again.
+class Take
+{
+public:
+	struct Event {
+		int pitch;
+		double start, end;
+	};
+	static const int pitchCount = 128;
+private:
+	std::vector<Event> events;
+
+	// by level, then by bucket
+	std::vector<std::vector<std::vector<uint32_t>>> buckets;
+
+	int minPitch, maxPitch;
+	std::vector<std::vector<uint16_t>> density;
+
+	double openStart[pitchCount];
+	double length;
+
+	void index(uint32_t eventIndex);
+	void addDensity(const Event &event);
+	void reduce(int level, int bin, int row);
+	void widen(int lowest, int highest);
+public:
+	Take();
+
+	void Clear();
+	void NoteOn(int pitch, double time);
+	void NoteOff(int pitch, double time);
+	void CloseOpenNotes(double time);
+	// replaces the take, with events as returned by GetEvents()
+	void Load(const Event *first, size_t count);
+
+	const std::vector<Event>& GetEvents() const;
+
+	size_t GetEventCount() const;
+	double GetLength() const;
+	double GetOpenStart(int pitch) const;
+	bool GetPitchRange(int *lowest, int *highest) const;
+
+	// appends every event overlapping [from, to] to `out'
+	void Query(double from, double to, std::vector<const Event*> &out) const;
+
+	int GetLevelCount() const;
+	double GetBinWidth(int level) const;
+	int GetBinCount(int level) const;
+	unsigned GetDensity(int level, int bin, int pitch) const;
+};
+
+#endif
+